@@ -0,0 +1,727 @@
+/**
+ * @file bitvector.h
+ * @brief Vector de bool empaquetado, 64 valores por palabra
+ *
+ * BitVector guarda un bit por elemento en palabras de 64 bits. Las consultas (`contar`,
+ * `contiene`, `buscarPrimero`/`buscarSiguiente`) y las operaciones en bloque (&, |, ^, ~)
+ * recorren palabras completas con popcount y countr_zero.
+ *
+ * Es un tipo aparte y no una especializacion de Vector<bool>: no ofrece referencias reales,
+ * vistas ni la API completa de Vector, así que empaquetar es una decisión explícita.
+ *
+ * @include bit
+ * @include cstdint
+ * @include cppvector.h
+ *
+ * @author Marian
+ * @date May 31st, 2025
+ *
+ **/
+
+#ifndef BITVECTOR_H
+#define BITVECTOR_H
+
+#include <bit>
+#include <cstdint>
+#include "cppvector.h"
+
+/**
+* @struct BitVector
+* @brief Vector de bool que empaqueta 64 valores por palabra.
+*
+* Ocupa un bit por elemento en lugar de un byte; `Vector<bool>` sigue guardando un bool por
+* elemento con la API completa de Vector. Las consultas trabajan palabra por
+* palabra: `contar` usa popcount, `contiene` compara palabras completas y
+* `buscarPrimero`/`buscarSiguiente` saltan directamente al siguiente bit activo.
+* Ademas ofrece operaciones en bloque (&, |, ^, ~) entre vectores del mismo tamaño.
+*
+* Como no se puede devolver una referencia a un bit, `operator[]` y los iteradores
+* devuelven una referencia proxy (BitVector::Referencia).
+*
+* @note Todos los bits a partir de `tamano_` (hasta la capacidad) se mantienen en 0.
+*
+* @tparam Allocator Allocator (se reasocia a palabras de 64 bits)
+*/
+template<typename Allocator = std::allocator<uint64_t> >
+struct BitVector {
+private:
+    using palabra = uint64_t;
+    using AllocPalabra = typename std::allocator_traits<Allocator>::template rebind_alloc<palabra>;
+
+    static constexpr size_t bits_palabra = 64;
+
+    palabra *datos_;        /// < Palabras con los bits empaquetados
+    size_t tamano_;         /// < Cantidad actual de elementos (bits)
+    size_t capacidad_;      /// < Capacidad reservada en bits (multiplo de 64)
+    AllocPalabra alloc;     /// < Allocator de palabras
+
+    static constexpr size_t palabrasPara(size_t bits) noexcept {
+        return (bits + bits_palabra - 1) / bits_palabra;
+    }
+
+    static constexpr palabra mascaraBit(size_t i) noexcept {
+        return palabra(1) << (i % bits_palabra);
+    }
+
+    /// Mascara con los bits validos de la ultima palabra usada.
+    [[nodiscard]] palabra mascaraFinal() const noexcept {
+        const size_t resto = tamano_ % bits_palabra;
+        return resto ? (palabra(1) << resto) - 1 : ~palabra(0);
+    }
+
+public:
+    using value_type = bool;
+    using size_type = size_t;
+
+    /**
+     * @struct Referencia
+     * @brief Referencia proxy a un bit del vector.
+     */
+    struct Referencia {
+        palabra *ptr;       /// < Palabra que contiene el bit
+        palabra mascara;    /// < Mascara del bit dentro de la palabra
+
+        constexpr Referencia(palabra *p, palabra m) noexcept : ptr(p), mascara(m) {}
+
+        constexpr operator bool() const noexcept {
+            return (*ptr & mascara) != 0;
+        }
+
+        constexpr Referencia &operator=(bool valor) noexcept {
+            if (valor) *ptr |= mascara; else *ptr &= ~mascara;
+            return *this;
+        }
+
+        constexpr Referencia &operator=(const Referencia &otro) noexcept {
+            return *this = static_cast<bool>(otro);
+        }
+
+        /**
+         * @brief Invierte el bit referenciado.
+         */
+        constexpr void flip() noexcept {
+            *ptr ^= mascara;
+        }
+
+        friend constexpr void swap(Referencia a, Referencia b) noexcept {
+            const bool aux = a;
+            a = static_cast<bool>(b);
+            b = aux;
+        }
+    };
+
+    using reference = Referencia;
+    using const_reference = bool;
+
+    //
+    //  INICIO SECCION ITERADORES
+    //
+
+    /**
+     * @struct IteradorBits
+     * @brief Iterador de acceso aleatorio sobre los bits (devuelve Referencia o bool).
+     */
+    template<bool Constante>
+    struct IteradorBits {
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = bool;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::conditional_t<Constante, bool, Referencia>;
+        using puntero = std::conditional_t<Constante, const palabra*, palabra*>;
+
+        puntero palabras;   /// < Inicio del arreglo de palabras
+        size_t indice;      /// < Bit actual
+
+        constexpr IteradorBits() noexcept : palabras(nullptr), indice(0) {}
+        constexpr IteradorBits(puntero p, size_t i) noexcept : palabras(p), indice(i) {}
+
+        constexpr reference operator*() const noexcept {
+            if constexpr (Constante) {
+                return (palabras[indice / bits_palabra] & mascaraBit(indice)) != 0;
+            } else {
+                return Referencia(palabras + indice / bits_palabra, mascaraBit(indice));
+            }
+        }
+        constexpr reference operator[](std::ptrdiff_t n) const noexcept { return *(*this + n); }
+
+        constexpr IteradorBits &operator++() noexcept { ++indice; return *this; }
+        constexpr IteradorBits operator++(int) noexcept { IteradorBits aux = *this; ++indice; return aux; }
+        constexpr IteradorBits &operator--() noexcept { --indice; return *this; }
+        constexpr IteradorBits operator--(int) noexcept { IteradorBits aux = *this; --indice; return aux; }
+
+        constexpr IteradorBits &operator+=(std::ptrdiff_t n) noexcept { indice += n; return *this; }
+        constexpr IteradorBits &operator-=(std::ptrdiff_t n) noexcept { indice -= n; return *this; }
+        constexpr IteradorBits operator+(std::ptrdiff_t n) const noexcept { return IteradorBits(palabras, indice + n); }
+        constexpr IteradorBits operator-(std::ptrdiff_t n) const noexcept { return IteradorBits(palabras, indice - n); }
+        constexpr difference_type operator-(const IteradorBits &o) const noexcept {
+            return static_cast<difference_type>(indice) - static_cast<difference_type>(o.indice);
+        }
+        friend constexpr IteradorBits operator+(std::ptrdiff_t n, const IteradorBits &it) noexcept { return it + n; }
+
+        constexpr bool operator==(const IteradorBits &o) const noexcept { return indice == o.indice; }
+        constexpr bool operator!=(const IteradorBits &o) const noexcept { return indice != o.indice; }
+        constexpr bool operator<(const IteradorBits &o) const noexcept { return indice < o.indice; }
+        constexpr bool operator>(const IteradorBits &o) const noexcept { return indice > o.indice; }
+        constexpr bool operator<=(const IteradorBits &o) const noexcept { return indice <= o.indice; }
+        constexpr bool operator>=(const IteradorBits &o) const noexcept { return indice >= o.indice; }
+    };
+
+    using Iterator = IteradorBits<false>;
+    using ConstIterator = IteradorBits<true>;
+    using ReverseIterator = std::reverse_iterator<Iterator>;
+    using ConstReverseIterator = std::reverse_iterator<ConstIterator>;
+
+    static_assert(std::random_access_iterator<ConstIterator>);
+
+    constexpr Iterator begin() noexcept { return Iterator(datos_, 0); }
+    constexpr Iterator end() noexcept { return Iterator(datos_, tamano_); }
+    constexpr ConstIterator begin() const noexcept { return ConstIterator(datos_, 0); }
+    constexpr ConstIterator end() const noexcept { return ConstIterator(datos_, tamano_); }
+    constexpr ConstIterator cbegin() const noexcept { return begin(); }
+    constexpr ConstIterator cend() const noexcept { return end(); }
+    constexpr ReverseIterator rbegin() noexcept { return ReverseIterator(end()); }
+    constexpr ReverseIterator rend() noexcept { return ReverseIterator(begin()); }
+    constexpr ConstReverseIterator crbegin() const noexcept { return ConstReverseIterator(end()); }
+    constexpr ConstReverseIterator crend() const noexcept { return ConstReverseIterator(begin()); }
+
+    //
+    //  FIN DE LA SECCION DE ITERADORES
+    //
+
+    BitVector() noexcept : datos_(nullptr), tamano_(0), capacidad_(0) {}
+
+    /**
+     * @brief Constructor para la initializer list
+     * @param lista
+     */
+    BitVector(std::initializer_list<bool> lista) : BitVector() {
+        reservar(lista.size());
+        for (bool dato : lista) {
+            if (dato) datos_[tamano_ / bits_palabra] |= mascaraBit(tamano_);
+            ++tamano_;
+        }
+    }
+
+    /**
+     * @brief Constructor que admite un tamaño y valor inicial (rellena palabras completas).
+     * @param Capacidad
+     * @param valor
+     */
+    explicit BitVector(size_t Capacidad, bool valor = false) : BitVector() {
+        redimensionar(Capacidad, valor);
+    }
+
+    /**
+     * Constructor que permite la inclusion de otro vector como inicializador
+     * @param otro
+     */
+    BitVector(const BitVector &otro) : BitVector() {
+        reservar(otro.tamano_);
+        if (otro.tamano_) {
+            std::memcpy(datos_, otro.datos_, palabrasPara(otro.tamano_) * sizeof(palabra));
+        }
+        tamano_ = otro.tamano_;
+    }
+
+    /**
+     * @brief Constructor para move semantics, admite otro vector como parametro
+     * @param otro
+     */
+    BitVector(BitVector &&otro) noexcept : datos_(otro.datos_), tamano_(otro.tamano_), capacidad_(otro.capacidad_) {
+        otro.datos_ = nullptr;
+        otro.tamano_ = 0;
+        otro.capacidad_ = 0;
+    }
+
+    ~BitVector() {
+        if (datos_) {
+            alloc.deallocate(datos_, palabrasPara(capacidad_));
+        }
+    }
+
+    BitVector &operator=(const BitVector &otro) {
+        if (this != &otro) {
+            BitVector temp(otro);
+            intercambiar(temp);
+        }
+        return *this;
+    }
+
+    BitVector &operator=(BitVector &&otro) noexcept {
+        if (this != &otro) {
+            BitVector temp(std::move(otro));
+            intercambiar(temp);
+        }
+        return *this;
+    }
+
+    //
+    //  ACCESO
+    //
+
+    Referencia operator[](size_t indice) noexcept {
+        return Referencia(datos_ + indice / bits_palabra, mascaraBit(indice));
+    }
+
+    bool operator[](size_t indice) const noexcept {
+        return (datos_[indice / bits_palabra] & mascaraBit(indice)) != 0;
+    }
+
+    /**
+     * @brief Devuelve el valor ubicado en un índice específico.
+     * @throws std::out_of_range si el índice es inválido.
+     */
+    Referencia en(size_t indice) {
+        if (indice >= tamano_) throw std::out_of_range("Indice fuera de rango");
+        return (*this)[indice];
+    }
+
+    bool en(size_t indice) const {
+        if (indice >= tamano_) throw std::out_of_range("Indice fuera de rango");
+        return (*this)[indice];
+    }
+
+    /**
+     * @brief Devuelve el primer valor.
+     * @throws std::out_of_range Si el vector está vacío.
+     */
+    bool frente() const {
+        if (tamano_ == 0) throw std::out_of_range("No hay elementos en el vector");
+        return (*this)[0];
+    }
+
+    /**
+     * @brief Devuelve el último valor.
+     * @throws std::out_of_range Si el vector está vacío.
+     */
+    bool atras() const {
+        if (tamano_ == 0) throw std::out_of_range("No hay elementos en el vector");
+        return (*this)[tamano_ - 1];
+    }
+
+    /**
+     * @brief Acceso directo a las palabras empaquetadas (64 bits cada una).
+     */
+    const palabra *data() const noexcept {
+        return datos_;
+    }
+
+    /**
+     * @brief Cantidad de palabras de 64 bits en uso.
+     */
+    [[nodiscard]] size_t cantidadPalabras() const noexcept {
+        return palabrasPara(tamano_);
+    }
+
+    //
+    //  CAPACIDAD
+    //
+
+    [[nodiscard]] bool vacio() const noexcept { return tamano_ == 0; }
+    [[nodiscard]] size_t obtenerTamano() const noexcept { return tamano_; }
+    [[nodiscard]] size_t obtenerCapacidad() const noexcept { return capacidad_; }
+    [[nodiscard]] size_t capacidadLibre() const noexcept { return capacidad_ - tamano_; }
+
+    /**
+    * @brief Reserva una nueva capacidad (en bits) para el vector.
+    * @param nuevaCapacidad Nueva capacidad deseada.
+    */
+    void reservar(size_t nuevaCapacidad) {
+        if (nuevaCapacidad > capacidad_) {
+            cambiarCapacidad(nuevaCapacidad);
+        }
+    }
+
+    /**
+    * @brief Reduce la capacidad a las palabras en uso.
+    */
+    void reducirCapacidad() {
+        if (palabrasPara(capacidad_) > palabrasPara(tamano_)) {
+            BitVector temp(*this);
+            intercambiar(temp);
+        }
+    }
+
+    //
+    //  MODIFICADORES
+    //
+
+    /**
+     * @brief Agrega un valor al final del vector.
+     * @param dato Valor a agregar.
+     */
+    void agregarFinal(bool dato) {
+        if (tamano_ == capacidad_) {
+            cambiarCapacidad(capacidad_ == 0 ? bits_palabra : capacidad_ * 2);
+        }
+        if (dato) datos_[tamano_ / bits_palabra] |= mascaraBit(tamano_);
+        ++tamano_;
+    }
+
+    void emplace_back(bool dato) {
+        agregarFinal(dato);
+    }
+
+    /**
+     * @brief Elimina el último elemento del vector.
+     * @throws std::out_of_range si el vector está vacío.
+     */
+    void eliminarFinal() {
+        if (tamano_ == 0) throw std::out_of_range("No hay elementos en el vector");
+        --tamano_;
+        datos_[tamano_ / bits_palabra] &= ~mascaraBit(tamano_);
+    }
+
+    /**
+     * @brief Redimensiona el vector rellenando palabras completas a la vez.
+     * @param nuevoTam Nuevo tamaño.
+     * @param dato Valor de los nuevos elementos.
+     */
+    void redimensionar(size_t nuevoTam, bool dato = false) {
+        if (nuevoTam < tamano_) {
+            ponerRango(nuevoTam, tamano_, false);
+        } else if (nuevoTam > tamano_) {
+            reservar(nuevoTam);
+            if (dato) ponerRango(tamano_, nuevoTam, true);
+        }
+        tamano_ = nuevoTam;
+    }
+
+    /**
+     * @brief Vacía el vector sin liberar memoria.
+     */
+    void vaciar() noexcept {
+        if (tamano_) {
+            std::memset(datos_, 0, palabrasPara(tamano_) * sizeof(palabra));
+        }
+        tamano_ = 0;
+    }
+
+    void intercambiar(BitVector &otro) noexcept {
+        std::swap(datos_, otro.datos_);
+        std::swap(tamano_, otro.tamano_);
+        std::swap(capacidad_, otro.capacidad_);
+    }
+
+    /**
+    * @brief Intercambia los elementos en los índices dados.
+    * @throws std::out_of_range Si alguno de los índices es inválido.
+    */
+    void intercambiarIndices(size_t i, size_t j) {
+        if (i >= tamano_ || j >= tamano_) throw std::out_of_range("Indice fuera de rango");
+        const bool aux = (*this)[i];
+        (*this)[i] = (*this)[j];
+        (*this)[j] = aux;
+    }
+
+    //
+    //  CONSULTAS POR PALABRA
+    //
+
+    /**
+    * @brief Cuenta cuántas veces aparece un valor (popcount por palabra).
+    * @param dato Valor a contar.
+    * @return Número de apariciones del valor.
+    */
+    size_t contar(bool dato) const noexcept {
+        size_t unos = 0;
+        const size_t n = palabrasPara(tamano_);
+        for (size_t w = 0; w < n; ++w) {
+            unos += static_cast<size_t>(std::popcount(datos_[w]));
+        }
+        return dato ? unos : tamano_ - unos;
+    }
+
+    /**
+    * @brief Verifica si el vector contiene un valor, comparando palabras completas.
+    * @param dato Valor a buscar.
+    * @return true si se encuentra el valor.
+    */
+    bool contiene(bool dato) const noexcept {
+        return buscarValor(dato, 0) < tamano_;
+    }
+
+    /**
+    * @brief Busca la primera aparición de un valor.
+    * @param dato Valor a buscar.
+    * @return Índice del valor si se encuentra, -1 en caso contrario.
+    */
+    int buscar(bool dato) const noexcept {
+        const size_t i = buscarValor(dato, 0);
+        return i < tamano_ ? static_cast<int>(i) : -1;
+    }
+
+    /**
+    * @brief Índice del primer bit activo.
+    * @return Índice encontrado, u obtenerTamano() si no hay ninguno.
+    */
+    [[nodiscard]] size_t buscarPrimero() const noexcept {
+        return buscarValor(true, 0);
+    }
+
+    /**
+    * @brief Índice del siguiente bit activo estrictamente después de `pos`.
+    * @return Índice encontrado, u obtenerTamano() si no hay ninguno.
+    */
+    [[nodiscard]] size_t buscarSiguiente(size_t pos) const noexcept {
+        return buscarValor(true, pos + 1);
+    }
+
+    /**
+     * @brief Verifica si el vector está ordenado (todos los false antes que los true).
+     *
+     * Se calcula en O(n / 64): tras el primer bit activo, todos los demás deben estarlo.
+     */
+    [[nodiscard]] bool estaOrdenado() const noexcept {
+        const size_t primero = buscarPrimero();
+        return primero >= tamano_ || contar(true) == tamano_ - primero;
+    }
+
+    //
+    //  METODOS PERSONALIZADOS
+    //
+
+    /**
+    * @brief Ordena el vector: cuenta los true y reescribe palabras completas.
+    */
+    void ordenar() noexcept {
+        const size_t unos = contar(true);
+        ponerRango(0, tamano_ - unos, false);
+        ponerRango(tamano_ - unos, tamano_, true);
+    }
+
+    /**
+    * @brief Invierte el orden de los elementos invirtiendo los bits de cada palabra.
+    */
+    void invertir() noexcept {
+        const size_t n = palabrasPara(tamano_);
+        if (n == 0) return;
+        std::reverse(datos_, datos_ + n);
+        for (size_t w = 0; w < n; ++w) {
+            datos_[w] = invertirBits(datos_[w]);
+        }
+        // Los bits quedaron alineados al final de la ultima palabra; se corren hacia el inicio
+        const size_t corrimiento = n * bits_palabra - tamano_;
+        if (corrimiento) {
+            for (size_t w = 0; w < n; ++w) {
+                const palabra siguiente = w + 1 < n ? datos_[w + 1] : 0;
+                datos_[w] = (datos_[w] >> corrimiento) | (siguiente << (bits_palabra - corrimiento));
+            }
+        }
+    }
+
+    /**
+    * @brief Reemplaza todas las apariciones de un dato por otro.
+    */
+    void reemplazar(bool dato, bool nuevo) noexcept {
+        if (dato != nuevo && contiene(dato)) {
+            ponerRango(0, tamano_, nuevo);
+        }
+    }
+
+    /**
+    * @brief Elimina los duplicados: quedan a lo sumo {false, true}.
+    */
+    void eliminarDuplicados() noexcept {
+        const bool ceros = contiene(false), unos = contiene(true);
+        vaciar();
+        if (ceros) agregarFinal(false);
+        if (unos) agregarFinal(true);
+    }
+
+    /**
+    * @brief Invierte todos los bits (NOT).
+    */
+    void negar() noexcept {
+        const size_t n = palabrasPara(tamano_);
+        for (size_t w = 0; w < n; ++w) {
+            datos_[w] = ~datos_[w];
+        }
+        if (n) datos_[n - 1] &= mascaraFinal();
+    }
+
+    /**
+    * @brief AND bit a bit con otro vector del mismo tamaño.
+    * @throws std::invalid_argument si los tamaños difieren.
+    */
+    BitVector &operator&=(const BitVector &otro) {
+        return combinar(otro, [](palabra a, palabra b) { return a & b; });
+    }
+
+    /**
+    * @brief OR bit a bit con otro vector del mismo tamaño.
+    * @throws std::invalid_argument si los tamaños difieren.
+    */
+    BitVector &operator|=(const BitVector &otro) {
+        return combinar(otro, [](palabra a, palabra b) { return a | b; });
+    }
+
+    /**
+    * @brief XOR bit a bit con otro vector del mismo tamaño.
+    * @throws std::invalid_argument si los tamaños difieren.
+    */
+    BitVector &operator^=(const BitVector &otro) {
+        return combinar(otro, [](palabra a, palabra b) { return a ^ b; });
+    }
+
+    friend BitVector operator&(BitVector a, const BitVector &b) { return a &= b; }
+    friend BitVector operator|(BitVector a, const BitVector &b) { return a |= b; }
+    friend BitVector operator^(BitVector a, const BitVector &b) { return a ^= b; }
+
+    BitVector operator~() const {
+        BitVector copia(*this);
+        copia.negar();
+        return copia;
+    }
+
+    bool operator==(const BitVector &otro) const noexcept {
+        return tamano_ == otro.tamano_ &&
+               (tamano_ == 0 || std::memcmp(datos_, otro.datos_, palabrasPara(tamano_) * sizeof(palabra)) == 0);
+    }
+
+    bool operator!=(const BitVector &otro) const noexcept {
+        return !(*this == otro);
+    }
+
+    friend std::ostream &operator<<(std::ostream &os, const BitVector &v) {
+        os << "[";
+        for (size_t i = 0; i < v.tamano_; i++) {
+            if (i > 0) os << ", ";
+            os << v[i];
+        }
+        os << "]";
+        return os;
+    }
+
+    /**
+     * @brief Muestra los elementos del vector por consola.
+     */
+    void mostrar() const {
+        for (size_t i = 0; i < tamano_; i++) {
+            std::cout << (*this)[i];
+            if (i + 1 != tamano_) {
+                std::cout << " - ";
+            }
+        }
+        std::cout << "\n";
+    }
+
+    /** @name Métodos compatibles con std::vector
+    *Métodos alternativos con nombres en inglés para facilitar la interoperabilidad.
+    */
+    ///@{
+    Referencia at(size_t index) { return en(index); }
+    bool at(size_t index) const { return en(index); }
+    bool front() const { return frente(); }
+    bool back() const { return atras(); }
+    [[nodiscard]] bool empty() const noexcept { return vacio(); }
+    [[nodiscard]] size_t size() const noexcept { return obtenerTamano(); }
+    [[nodiscard]] size_t capacity() const noexcept { return obtenerCapacidad(); }
+    [[nodiscard]] bool isSorted() const noexcept { return estaOrdenado(); }
+    size_t static max_size() { return std::numeric_limits<size_t>::max(); }
+    void reserve(size_t newCapacity) { reservar(newCapacity); }
+    void shrink_to_fit() { reducirCapacidad(); }
+    void push_back(bool value) { agregarFinal(value); }
+    void pop_back() { eliminarFinal(); }
+    void resize(size_t newSize, bool value = false) { redimensionar(newSize, value); }
+    void clear() noexcept { vaciar(); }
+    void swap(BitVector &other) noexcept { intercambiar(other); }
+    void swap_indices(size_t indexA, size_t indexB) { intercambiarIndices(indexA, indexB); }
+    size_t count(bool value) const noexcept { return contar(value); }
+    bool contains(bool value) const noexcept { return contiene(value); }
+    [[nodiscard]] size_t find_first() const noexcept { return buscarPrimero(); }
+    [[nodiscard]] size_t find_next(size_t pos) const noexcept { return buscarSiguiente(pos); }
+    void sort() noexcept { ordenar(); }
+    void reverse() noexcept { invertir(); }
+    void replace_all(bool oldValue, bool newValue) noexcept { reemplazar(oldValue, newValue); }
+    void remove_duplicates() noexcept { eliminarDuplicados(); }
+    void flip() noexcept { negar(); }
+    void display() const { mostrar(); }
+    ///@}
+
+private:
+    /**
+    * @brief Cambia la capacidad (redondeada a palabras completas); las palabras nuevas quedan en 0.
+    */
+    void cambiarCapacidad(size_t nuevaCapacidad) {
+        const size_t palabrasNuevas = palabrasPara(nuevaCapacidad);
+        const size_t palabrasViejas = palabrasPara(capacidad_);
+        if (palabrasNuevas <= palabrasViejas && datos_ != nullptr) return;
+
+        palabra *nuevo = alloc.allocate(palabrasNuevas);
+        const size_t usadas = palabrasPara(tamano_);
+        if (usadas) {
+            std::memcpy(nuevo, datos_, usadas * sizeof(palabra));
+        }
+        std::memset(nuevo + usadas, 0, (palabrasNuevas - usadas) * sizeof(palabra));
+        if (datos_) {
+            alloc.deallocate(datos_, palabrasViejas);
+        }
+        datos_ = nuevo;
+        capacidad_ = palabrasNuevas * bits_palabra;
+    }
+
+    /**
+    * @brief Pone en `valor` los bits [desde, hasta), palabra por palabra.
+    */
+    void ponerRango(size_t desde, size_t hasta, bool valor) noexcept {
+        if (desde >= hasta) return;
+        size_t w = desde / bits_palabra;
+        const size_t ultima = (hasta - 1) / bits_palabra;
+        const palabra inicio = ~palabra(0) << (desde % bits_palabra);
+        const palabra fin = ~palabra(0) >> (bits_palabra - 1 - (hasta - 1) % bits_palabra);
+        if (w == ultima) {
+            const palabra m = inicio & fin;
+            datos_[w] = valor ? (datos_[w] | m) : (datos_[w] & ~m);
+            return;
+        }
+        datos_[w] = valor ? (datos_[w] | inicio) : (datos_[w] & ~inicio);
+        if (ultima > w + 1) {
+            std::memset(datos_ + w + 1, valor ? 0xFF : 0, (ultima - w - 1) * sizeof(palabra));
+        }
+        datos_[ultima] = valor ? (datos_[ultima] | fin) : (datos_[ultima] & ~fin);
+    }
+
+    /**
+    * @brief Primer índice >= desde cuyo bit vale `dato`, u obtenerTamano() si no hay.
+    */
+    [[nodiscard]] size_t buscarValor(bool dato, size_t desde) const noexcept {
+        if (desde >= tamano_) return tamano_;
+        const size_t n = palabrasPara(tamano_);
+        size_t w = desde / bits_palabra;
+        palabra actual = (dato ? datos_[w] : ~datos_[w]) & (~palabra(0) << (desde % bits_palabra));
+        while (true) {
+            if (w == n - 1) {
+                actual &= mascaraFinal();
+            }
+            if (actual) {
+                return w * bits_palabra + static_cast<size_t>(std::countr_zero(actual));
+            }
+            if (++w >= n) return tamano_;
+            actual = dato ? datos_[w] : ~datos_[w];
+        }
+    }
+
+    template<typename Op>
+    BitVector &combinar(const BitVector &otro, Op op) {
+        if (otro.tamano_ != tamano_) {
+            throw std::invalid_argument("Los vectores deben tener el mismo tamaño");
+        }
+        const size_t n = palabrasPara(tamano_);
+        for (size_t w = 0; w < n; ++w) {
+            datos_[w] = op(datos_[w], otro.datos_[w]);
+        }
+        return *this;
+    }
+
+    static constexpr palabra invertirBits(palabra x) noexcept {
+        x = ((x >> 1) & 0x5555555555555555ULL) | ((x & 0x5555555555555555ULL) << 1);
+        x = ((x >> 2) & 0x3333333333333333ULL) | ((x & 0x3333333333333333ULL) << 2);
+        x = ((x >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((x & 0x0F0F0F0F0F0F0F0FULL) << 4);
+        x = ((x >> 8) & 0x00FF00FF00FF00FFULL) | ((x & 0x00FF00FF00FF00FFULL) << 8);
+        x = ((x >> 16) & 0x0000FFFF0000FFFFULL) | ((x & 0x0000FFFF0000FFFFULL) << 16);
+        return (x >> 32) | (x << 32);
+    }
+};
+
+#endif //BITVECTOR_H
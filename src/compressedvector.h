@@ -0,0 +1,631 @@
+/**
+ * @file compressedvector.h
+ * @brief Vector de enteros comprimido por bloques (frame of reference / delta + bit packing)
+ *
+ * CompressedVector guarda los enteros en bloques de 128 valores. Cada bloque se codifica
+ * restando su minimo (frame of reference) o, si esta ordenado y resulta mas chico, como
+ * diferencias entre valores consecutivos (delta). El resultado se empaqueta con el ancho de
+ * bits justo para el mayor valor del bloque: una lista ordenada de IDs cuyas diferencias
+ * entran en 10-12 bits ocupa ~1.5 bytes por elemento en lugar de 8.
+ *
+ * Cada bloque recuerda su minimo y su maximo, lo que permite a `contiene` y `buscar` saltar
+ * los bloques que no pueden contener el valor sin descomprimirlos.
+ *
+ * @include array
+ * @include cppvector.h
+ *
+ * @author Marian
+ * @date May 31st, 2025
+ *
+ **/
+
+#ifndef COMPRESSEDVECTOR_H
+#define COMPRESSEDVECTOR_H
+
+#include <array>
+#include "cppvector.h"
+
+/**
+* @struct CompressedVector
+* @brief Vector de enteros de solo agregado, comprimido en bloques de 128 valores.
+*
+* Los ultimos elementos (menos de 128) se guardan sin comprimir hasta completar un bloque.
+* El acceso aleatorio desempaqueta un solo valor (o, en bloques delta, la suma de las
+* diferencias hasta la posicion pedida); la iteracion descomprime un bloque entero de una vez.
+*
+* @tparam tipodato Tipo entero almacenado
+*/
+template<typename tipodato>
+struct CompressedVector {
+    static_assert(std::is_integral_v<tipodato> && !std::is_same_v<tipodato, bool>,
+                  "CompressedVector solo admite tipos enteros");
+
+    static constexpr size_t tamano_bloque = 128;    /// < Valores por bloque
+
+    /**
+     * @brief Codificacion usada por un bloque.
+     */
+    enum class Codificacion : uint8_t {
+        Referencia,     /// < valor - minimo del bloque
+        Delta           /// < valor - valor anterior (solo bloques ordenados)
+    };
+
+private:
+    using sin_signo = std::make_unsigned_t<tipodato>;
+
+    /**
+     * @brief Metadatos de un bloque comprimido. Sus datos ocupan 2 * ancho palabras.
+     */
+    struct Bloque {
+        tipodato minimo;                /// < Menor valor (y primer valor en bloques delta)
+        tipodato maximo;                /// < Mayor valor
+        size_t desplazamiento;          /// < Primera palabra del bloque en palabras_
+        uint8_t ancho;                  /// < Bits por valor empaquetado
+        Codificacion codificacion;      /// < Forma de codificar los valores
+    };
+
+    Vector<uint64_t> palabras_;         /// < Bits empaquetados, mas una palabra de relleno al final
+    Vector<Bloque> bloques_;            /// < Metadatos de cada bloque comprimido
+    Vector<tipodato> cola_;             /// < Elementos del bloque incompleto, sin comprimir
+    tipodato ultimo_;                   /// < Ultimo elemento agregado
+    size_t tamano_;                     /// < Cantidad total de elementos
+    bool ordenado_;                     /// < true si todos los elementos estan en orden no decreciente
+
+public:
+    CompressedVector() : ultimo_(), tamano_(0), ordenado_(true) {
+        // La palabra de relleno permite leer siempre la palabra siguiente sin comprobar limites
+        palabras_.agregarFinal(0);
+        cola_.reservar(tamano_bloque);
+    }
+
+    /**
+     * @brief Constructor para la initializer list
+     * @param lista
+     */
+    CompressedVector(std::initializer_list<tipodato> lista) : CompressedVector() {
+        for (const tipodato &dato : lista) {
+            agregarFinal(dato);
+        }
+    }
+
+    /**
+     * @brief Comprime los elementos de un Vector en O(n).
+     * @param v
+     */
+    explicit CompressedVector(const Vector<tipodato> &v) : CompressedVector() {
+        bloques_.reservar(v.obtenerTamano() / tamano_bloque);
+        for (const tipodato &dato : v) {
+            agregarFinal(dato);
+        }
+    }
+
+    //
+    //  LECTURA
+    //
+
+    /**
+    * @brief Accede a un valor por índice (no verificado).
+    * @param indice Índice del valor.
+    * @return Copia del valor (los valores empaquetados no tienen dirección propia).
+    */
+    tipodato operator[](size_t indice) const {
+        const size_t b = indice / tamano_bloque;
+        if (b >= bloques_.obtenerTamano()) {
+            return cola_[indice - b * tamano_bloque];
+        }
+        const Bloque &bloque = bloques_[b];
+        const size_t k = indice % tamano_bloque;
+        if (bloque.codificacion == Codificacion::Referencia) {
+            return static_cast<tipodato>(static_cast<sin_signo>(bloque.minimo) + leer(bloque, k));
+        }
+        sin_signo acumulado = static_cast<sin_signo>(bloque.minimo);
+        for (size_t j = 1; j <= k; ++j) {
+            acumulado += static_cast<sin_signo>(leer(bloque, j));
+        }
+        return static_cast<tipodato>(acumulado);
+    }
+
+    /**
+     * @brief Devuelve el valor ubicado en un índice específico.
+     * @param indice Índice del valor.
+     * @return Copia del valor.
+     * @throws std::out_of_range si el índice es inválido.
+     */
+    tipodato en(size_t indice) const {
+        if (indice >= tamano_) {
+            throw std::out_of_range("Indice fuera de rango");
+        }
+        return (*this)[indice];
+    }
+
+    [[nodiscard]] size_t obtenerTamano() const noexcept {
+        return tamano_;
+    }
+
+    [[nodiscard]] bool vacio() const noexcept {
+        return tamano_ == 0;
+    }
+
+    [[nodiscard]] bool estaOrdenado() const noexcept {
+        return ordenado_;
+    }
+
+    /**
+     * @brief Cantidad de bloques comprimidos (sin contar los elementos aun sin comprimir).
+     */
+    [[nodiscard]] size_t cantidadBloques() const noexcept {
+        return bloques_.obtenerTamano();
+    }
+
+    /**
+     * @brief Memoria ocupada por los datos, en bytes (sin contar la capacidad libre).
+     */
+    [[nodiscard]] size_t bytesUsados() const noexcept {
+        return palabras_.obtenerTamano() * sizeof(uint64_t) +
+               bloques_.obtenerTamano() * sizeof(Bloque) +
+               cola_.obtenerTamano() * sizeof(tipodato);
+    }
+
+    //
+    //  BUSQUEDA
+    //
+
+    /**
+    * @brief Verifica si el vector contiene un valor.
+    *
+    * Solo descomprime los bloques cuyo rango [minimo, maximo] incluye el valor; si el
+    * vector esta ordenado, elige el unico bloque candidato con búsqueda binaria.
+    *
+    * @param dato Valor a buscar.
+    * @return true si se encuentra el valor.
+    */
+    bool contiene(const tipodato &dato) const {
+        return buscar(dato) != -1;
+    }
+
+    /**
+    * @brief Busca la primera aparición de un valor.
+    * @param dato Valor a buscar.
+    * @return Índice del valor si se encuentra, -1 en caso contrario.
+    */
+    int buscar(const tipodato &dato) const {
+        std::array<tipodato, tamano_bloque> buffer;
+        const size_t n = bloques_.obtenerTamano();
+        size_t b = 0;
+        if (ordenado_) {
+            // Primer bloque cuyo maximo no es menor que el dato
+            b = static_cast<size_t>(std::partition_point(bloques_.begin(), bloques_.end(),
+                [&dato](const Bloque &bloque) { return bloque.maximo < dato; }) - bloques_.begin());
+        }
+        for (; b < n; ++b) {
+            const Bloque &bloque = bloques_[b];
+            if (dato < bloque.minimo) {
+                if (ordenado_) return -1;
+                continue;
+            }
+            if (bloque.maximo < dato) continue;
+            decodificar(bloque, buffer.data());
+            const tipodato *pos = ordenado_ ? std::lower_bound(buffer.begin(), buffer.end(), dato)
+                                            : std::find(buffer.begin(), buffer.end(), dato);
+            if (pos != buffer.end() && *pos == dato) {
+                return static_cast<int>(b * tamano_bloque + (pos - buffer.data()));
+            }
+        }
+        const int enCola = cola_.buscar(dato);
+        return enCola == -1 ? -1 : static_cast<int>(n * tamano_bloque) + enCola;
+    }
+
+    //
+    //  MODIFICADORES
+    //
+
+    /**
+     * @brief Agrega un valor al final; cada 128 valores se comprime un bloque.
+     * @param dato Valor a agregar.
+     */
+    void agregarFinal(const tipodato &dato) {
+        if (tamano_ > 0 && dato < ultimo_) {
+            ordenado_ = false;
+        }
+        ultimo_ = dato;
+        cola_.agregarFinal(dato);
+        ++tamano_;
+        if (cola_.obtenerTamano() == tamano_bloque) {
+            sellarBloque();
+        }
+    }
+
+    /**
+     * @brief Vacía el vector.
+     */
+    void vaciar() {
+        palabras_.vaciar();
+        palabras_.agregarFinal(0);
+        bloques_.vaciar();
+        cola_.vaciar();
+        tamano_ = 0;
+        ordenado_ = true;
+    }
+
+    //
+    //  DESCOMPRESION
+    //
+
+    /**
+     * @brief Descomprime un bloque completo.
+     * @param b Índice del bloque (0 <= b < cantidadBloques()).
+     * @param destino Arreglo de al menos 128 elementos.
+     * @throws std::out_of_range si el bloque no existe.
+     */
+    void decodificarBloque(size_t b, tipodato *destino) const {
+        if (b >= bloques_.obtenerTamano()) {
+            throw std::out_of_range("Indice fuera de rango");
+        }
+        decodificar(bloques_[b], destino);
+    }
+
+    /**
+     * @brief Recorre los elementos en orden, entregando cada bloque ya descomprimido.
+     *
+     * @tparam F Invocable con la firma `void(const tipodato* datos, size_t cantidad)`.
+     * @param f Funcion a aplicar a cada bloque.
+     */
+    template<typename F>
+    void paraCadaBloque(F &&f) const {
+        std::array<tipodato, tamano_bloque> buffer;
+        for (const Bloque &bloque : bloques_) {
+            decodificar(bloque, buffer.data());
+            f(static_cast<const tipodato *>(buffer.data()), tamano_bloque);
+        }
+        if (!cola_.vacio()) {
+            f(cola_.data(), cola_.obtenerTamano());
+        }
+    }
+
+    /**
+     * @brief Descomprime todo el contenido en un Vector contiguo, reservando una sola vez.
+     * @return Vector con los elementos en orden.
+     */
+    Vector<tipodato> aVector() const {
+        Vector<tipodato> resultado;
+        resultado.reservar(tamano_);
+        paraCadaBloque([&resultado](const tipodato *datos, size_t cantidad) {
+            for (size_t i = 0; i < cantidad; ++i) {
+                resultado.agregarFinal(datos[i]);
+            }
+        });
+        return resultado;
+    }
+
+    bool operator==(const CompressedVector &otro) const {
+        if (tamano_ != otro.tamano_) return false;
+        auto a = begin();
+        for (auto b = otro.begin(); b != otro.end(); ++a, ++b) {
+            if (*a != *b) return false;
+        }
+        return true;
+    }
+
+    bool operator!=(const CompressedVector &otro) const {
+        return !(*this == otro);
+    }
+
+    /**
+    * @brief Operador de salida.
+    * @param os Flujo de salida.
+    * @param v Vector a imprimir.
+    * @return Referencia al flujo de salida.
+    */
+    friend std::ostream &operator<<(std::ostream &os, const CompressedVector &v) {
+        os << "[";
+        bool primero = true;
+        v.paraCadaBloque([&](const tipodato *datos, size_t cantidad) {
+            for (size_t i = 0; i < cantidad; ++i) {
+                if (!primero) os << ", ";
+                os << datos[i];
+                primero = false;
+            }
+        });
+        os << "]";
+        return os;
+    }
+
+    //
+    //  ITERADORES
+    //
+
+    /**
+     * @struct ConstIterator
+     * @brief Iterador constante que descomprime un bloque completo cada 128 elementos.
+     *
+     * Guarda el bloque descomprimido, por lo que copiar el iterador copia hasta 128 valores.
+     */
+    struct ConstIterator {
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = tipodato;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const tipodato*;
+        using reference = const tipodato&;
+
+        const CompressedVector *vec = nullptr;          /// < Vector recorrido
+        size_t indice = 0;                              /// < Posicion actual
+        const tipodato *bloque = nullptr;               /// < Elementos del bloque actual
+        size_t inicioBloque = 0;                        /// < Indice del primer elemento del bloque
+        std::array<tipodato, tamano_bloque> buffer{};   /// < Bloque descomprimido
+
+        ConstIterator() = default;
+
+        ConstIterator(const CompressedVector *v, size_t i) : vec(v), indice(i) {
+            cargarBloque();
+        }
+
+        ConstIterator(const ConstIterator &o) : vec(o.vec), indice(o.indice), inicioBloque(o.inicioBloque), buffer(o.buffer) {
+            reubicar(o);
+        }
+
+        ConstIterator &operator=(const ConstIterator &o) {
+            vec = o.vec;
+            indice = o.indice;
+            inicioBloque = o.inicioBloque;
+            buffer = o.buffer;
+            reubicar(o);
+            return *this;
+        }
+
+        const tipodato &operator*() const {
+            return bloque[indice - inicioBloque];
+        }
+
+        const tipodato *operator->() const {
+            return &bloque[indice - inicioBloque];
+        }
+
+        ConstIterator &operator++() {
+            if (++indice % tamano_bloque == 0) {
+                cargarBloque();
+            }
+            return *this;
+        }
+
+        ConstIterator operator++(int) {
+            ConstIterator aux = *this;
+            ++*this;
+            return aux;
+        }
+
+        bool operator==(const ConstIterator &o) const {
+            return indice == o.indice;
+        }
+
+        bool operator!=(const ConstIterator &o) const {
+            return indice != o.indice;
+        }
+
+    private:
+        void cargarBloque() {
+            if (vec == nullptr || indice >= vec->tamano_) return;
+            const size_t b = indice / tamano_bloque;
+            inicioBloque = b * tamano_bloque;
+            if (b < vec->bloques_.obtenerTamano()) {
+                vec->decodificar(vec->bloques_[b], buffer.data());
+                bloque = buffer.data();
+            } else {
+                bloque = vec->cola_.data();
+            }
+        }
+
+        /// El bloque apunta al buffer propio salvo en la cola, que vive en el vector.
+        void reubicar(const ConstIterator &o) {
+            bloque = (o.bloque == o.buffer.data()) ? buffer.data() : o.bloque;
+        }
+    };
+
+    ConstIterator begin() const { return ConstIterator(this, 0); }
+    ConstIterator end() const { return ConstIterator(this, tamano_); }
+    ConstIterator cbegin() const { return begin(); }
+    ConstIterator cend() const { return end(); }
+
+    static_assert(std::forward_iterator<ConstIterator>);
+
+    /** @name Métodos compatibles con std::vector
+    *Métodos alternativos con nombres en inglés para facilitar la interoperabilidad.
+    */
+    ///@{
+
+    tipodato at(size_t index) const {
+        return en(index);
+    }
+    [[nodiscard]] size_t size() const noexcept {
+        return obtenerTamano();
+    }
+    [[nodiscard]] bool empty() const noexcept {
+        return vacio();
+    }
+    [[nodiscard]] bool isSorted() const noexcept {
+        return estaOrdenado();
+    }
+    bool contains(const tipodato &value) const {
+        return contiene(value);
+    }
+    int find(const tipodato &value) const {
+        return buscar(value);
+    }
+    void push_back(const tipodato &value) {
+        agregarFinal(value);
+    }
+    void clear() {
+        vaciar();
+    }
+    [[nodiscard]] size_t block_count() const noexcept {
+        return cantidadBloques();
+    }
+    /**
+    * @brief Bytes used by the compressed data (excluding spare capacity).
+    */
+    [[nodiscard]] size_t memory_usage() const noexcept {
+        return bytesUsados();
+    }
+    /**
+    * @brief Decodes block `b` into `out`, which must hold at least 128 values.
+    */
+    void decode_block(size_t b, tipodato *out) const {
+        decodificarBloque(b, out);
+    }
+    /**
+    * @brief Visits the elements as decoded (pointer, count) blocks.
+    */
+    template<typename F>
+    void for_each_chunk(F &&f) const {
+        paraCadaBloque(std::forward<F>(f));
+    }
+    /**
+    * @brief Decodes everything into a contiguous Vector.
+    */
+    Vector<tipodato> to_vector() const {
+        return aVector();
+    }
+
+    ///@}
+
+private:
+    static constexpr uint64_t mascara(unsigned ancho) noexcept {
+        return ancho >= 64 ? ~uint64_t(0) : (uint64_t(1) << ancho) - 1;
+    }
+
+    /**
+     * @brief Lee el valor empaquetado k de un bloque.
+     */
+    uint64_t leer(const Bloque &bloque, size_t k) const {
+        if (bloque.ancho == 0) return 0;
+        const uint64_t *p = palabras_.data() + bloque.desplazamiento;
+        const size_t bit = k * bloque.ancho;
+        const size_t desfase = bit % 64;
+        const uint64_t bajo = p[bit / 64];
+        const uint64_t alto = p[bit / 64 + 1];
+        // (alto << 1) << (63 - desfase) evita el corrimiento indefinido de 64 bits cuando desfase == 0
+        return ((bajo >> desfase) | ((alto << 1) << (63 - desfase))) & mascara(bloque.ancho);
+    }
+
+    /**
+     * @brief Desempaqueta los 128 valores de un bloque.
+     *
+     * Con AVX2 procesa cuatro valores por iteracion: cada carril recoge (gather) las dos
+     * palabras donde cae su valor y las combina con corrimientos variables.
+     */
+    void desempaquetar(const Bloque &bloque, uint64_t *destino) const {
+        const uint64_t *p = palabras_.data() + bloque.desplazamiento;
+        const unsigned ancho = bloque.ancho;
+        if (ancho == 0) {
+            std::fill(destino, destino + tamano_bloque, uint64_t(0));
+            return;
+        }
+        size_t k = 0;
+#if defined(__AVX2__)
+        const __m256i mascaraV = _mm256_set1_epi64x(static_cast<long long>(mascara(ancho)));
+        const __m256i sesentaYCuatro = _mm256_set1_epi64x(64);
+        const __m256i sesentaYTres = _mm256_set1_epi64x(63);
+        const __m256i uno = _mm256_set1_epi64x(1);
+        __m256i bits = _mm256_setr_epi64x(0, ancho, 2 * ancho, 3 * ancho);
+        const __m256i paso = _mm256_set1_epi64x(4 * ancho);
+        for (; k < tamano_bloque; k += 4) {
+            const __m256i palabra = _mm256_srli_epi64(bits, 6);
+            const __m256i desfase = _mm256_and_si256(bits, sesentaYTres);
+            const auto base = reinterpret_cast<const long long *>(p);
+            const __m256i bajo = _mm256_i64gather_epi64(base, palabra, 8);
+            const __m256i alto = _mm256_i64gather_epi64(base, _mm256_add_epi64(palabra, uno), 8);
+            // sllv con cuenta 64 produce 0, justo lo necesario cuando desfase == 0
+            const __m256i valor = _mm256_or_si256(_mm256_srlv_epi64(bajo, desfase),
+                                                  _mm256_sllv_epi64(alto, _mm256_sub_epi64(sesentaYCuatro, desfase)));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(destino + k), _mm256_and_si256(valor, mascaraV));
+            bits = _mm256_add_epi64(bits, paso);
+        }
+#endif
+        const uint64_t m = mascara(ancho);
+        for (; k < tamano_bloque; ++k) {
+            const size_t bit = k * ancho;
+            const size_t desfase = bit % 64;
+            destino[k] = ((p[bit / 64] >> desfase) | ((p[bit / 64 + 1] << 1) << (63 - desfase))) & m;
+        }
+    }
+
+    /**
+     * @brief Descomprime un bloque: suma el minimo (referencia) o acumula las diferencias (delta).
+     */
+    void decodificar(const Bloque &bloque, tipodato *destino) const {
+        alignas(32) uint64_t valores[tamano_bloque];
+        desempaquetar(bloque, valores);
+        const sin_signo base = static_cast<sin_signo>(bloque.minimo);
+        if (bloque.codificacion == Codificacion::Referencia) {
+            for (size_t k = 0; k < tamano_bloque; ++k) {
+                destino[k] = static_cast<tipodato>(static_cast<sin_signo>(base + valores[k]));
+            }
+        } else {
+            sin_signo acumulado = base;
+            destino[0] = bloque.minimo;
+            for (size_t k = 1; k < tamano_bloque; ++k) {
+                acumulado += static_cast<sin_signo>(valores[k]);
+                destino[k] = static_cast<tipodato>(acumulado);
+            }
+        }
+    }
+
+    /**
+     * @brief Comprime los 128 elementos de la cola en un bloque nuevo.
+     *
+     * Usa delta si el bloque esta ordenado y las diferencias necesitan menos bits que
+     * los valores relativos al minimo.
+     */
+    void sellarBloque() {
+        const tipodato *datos = cola_.data();
+        tipodato minimo = datos[0], maximo = datos[0];
+        sin_signo mayorDelta = 0;
+        bool enOrden = true;
+        for (size_t k = 1; k < tamano_bloque; ++k) {
+            if (datos[k] < minimo) minimo = datos[k];
+            if (maximo < datos[k]) maximo = datos[k];
+            if (datos[k] < datos[k - 1]) {
+                enOrden = false;
+            } else {
+                mayorDelta = std::max<sin_signo>(mayorDelta, static_cast<sin_signo>(datos[k]) - static_cast<sin_signo>(datos[k - 1]));
+            }
+        }
+        const auto anchoReferencia = static_cast<uint8_t>(std::bit_width(static_cast<sin_signo>(static_cast<sin_signo>(maximo) - static_cast<sin_signo>(minimo))));
+        const auto anchoDelta = static_cast<uint8_t>(std::bit_width(mayorDelta));
+
+        Bloque bloque{};
+        bloque.minimo = minimo;
+        bloque.maximo = maximo;
+        bloque.codificacion = Codificacion::Referencia;
+        bloque.ancho = anchoReferencia;
+        if (enOrden && anchoDelta < anchoReferencia) {
+            bloque.codificacion = Codificacion::Delta;
+            bloque.ancho = anchoDelta;
+        }
+
+        // Se reemplaza la palabra de relleno por las 2 * ancho palabras del bloque y se repone al final
+        bloque.desplazamiento = palabras_.obtenerTamano() - 1;
+        const size_t necesarias = bloque.desplazamiento + 2 * size_t(bloque.ancho) + 1;
+        if (necesarias > palabras_.obtenerCapacidad()) {
+            // redimensionar reserva lo justo; crecer al menos al doble evita realocar en cada bloque
+            palabras_.reservar(std::max(necesarias, 2 * palabras_.obtenerCapacidad()));
+        }
+        palabras_.redimensionar(necesarias, 0);
+        uint64_t *p = palabras_.data() + bloque.desplazamiento;
+        for (size_t k = 0; k < tamano_bloque && bloque.ancho > 0; ++k) {
+            const sin_signo anterior = bloque.codificacion == Codificacion::Delta
+                                       ? static_cast<sin_signo>(k == 0 ? datos[0] : datos[k - 1])
+                                       : static_cast<sin_signo>(minimo);
+            const uint64_t valor = static_cast<sin_signo>(static_cast<sin_signo>(datos[k]) - anterior);
+            const size_t bit = k * bloque.ancho;
+            const size_t desfase = bit % 64;
+            p[bit / 64] |= valor << desfase;
+            if (desfase + bloque.ancho > 64) {
+                p[bit / 64 + 1] |= valor >> (64 - desfase);
+            }
+        }
+        bloques_.agregarFinal(bloque);
+        cola_.vaciar();
+    }
+};
+
+#endif //COMPRESSEDVECTOR_H
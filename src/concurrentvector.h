@@ -0,0 +1,341 @@
+/**
+ * @file concurrentvector.h
+ * @brief Vector para agregar elementos desde muchos hilos sin bloqueos
+ *
+ * ConcurrentVector reserva la posicion de cada elemento nuevo con un unico fetch_add atomico,
+ * de modo que los productores nunca esperan a otro hilo ni a una realocacion. Los elementos
+ * viven en segmentos de tamaño creciente (64, 128, 256, ...) que nunca se mueven una vez
+ * creados, asi que una referencia a un elemento publicado sigue siendo valida mientras el
+ * vector exista.
+ *
+ * Cuando termina la ingesta, `drenarEn` mueve todo en orden a un Vector contiguo normal y
+ * deja los segmentos listos para reutilizarse.
+ *
+ * @include atomic
+ * @include memory
+ * @include cppvector.h
+ *
+ * @author Marian
+ * @date May 31st, 2025
+ *
+ **/
+
+#ifndef CONCURRENTVECTOR_H
+#define CONCURRENTVECTOR_H
+
+#include <atomic>
+#include <memory>
+#include "cppvector.h"
+
+/**
+* @struct ConcurrentVector
+* @brief Vector segmentado con inserción concurrente mediante reserva atómica de posiciones.
+*
+* `agregarFinal`, `emplace_back`, `reservar`, `estaPublicado`, `en` y `operator[]` pueden
+* llamarse a la vez desde cualquier número de hilos. `drenarEn`, `vaciar` y el destructor
+* requieren que ningún otro hilo esté usando el vector.
+*
+* @tparam tipodato Tipo de dato almacenado
+*/
+template<typename tipodato>
+struct ConcurrentVector {
+private:
+    static constexpr size_t bitsPrimerSegmento_ = 6;                        /// < El segmento 0 tiene 64 posiciones
+    static constexpr size_t primerSegmento_ = size_t(1) << bitsPrimerSegmento_;
+    static constexpr size_t maxSegmentos_ = 64 - bitsPrimerSegmento_;
+
+    /**
+     * @brief Bloque de posiciones que nunca se mueve; `listos[i]` indica que `datos[i]` ya está construido.
+     */
+    struct Segmento {
+        tipodato *datos;
+        std::unique_ptr<std::atomic<bool>[]> listos;
+        size_t capacidad;
+    };
+
+    alignas(64) std::atomic<size_t> tamano_;                         /// < Posiciones reservadas
+    alignas(64) std::atomic<Segmento *> segmentos_[maxSegmentos_];   /// < Segmento k: primerSegmento_ << k posiciones
+
+public:
+    ConcurrentVector() : tamano_(0) {
+        for (auto &segmento : segmentos_) {
+            segmento.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    ConcurrentVector(const ConcurrentVector &) = delete;
+    ConcurrentVector &operator=(const ConcurrentVector &) = delete;
+
+    ~ConcurrentVector() {
+        vaciar();
+        for (auto &segmento : segmentos_) {
+            liberarSegmento(segmento.load(std::memory_order_relaxed));
+        }
+    }
+
+    //
+    //  INSERCION CONCURRENTE
+    //
+
+    /**
+     * @brief Agrega un elemento al final; seguro desde varios hilos a la vez.
+     *
+     * La posición se obtiene con un fetch_add, por lo que ningún productor espera a otro. Solo
+     * el primer hilo que llega a un segmento nuevo lo reserva; si otro se le adelanta, libera
+     * su bloque y usa el ya publicado.
+     *
+     * @param dato Elemento a agregar.
+     * @return Índice asignado al elemento.
+     */
+    size_t agregarFinal(const tipodato &dato) {
+        return emplace_back(dato);
+    }
+
+    size_t agregarFinal(tipodato &&dato) {
+        return emplace_back(std::move(dato));
+    }
+
+    /**
+     * @brief Construye un elemento al final; seguro desde varios hilos a la vez.
+     * @return Índice asignado al elemento.
+     */
+    template<typename... Args>
+    size_t emplace_back(Args&&... args) {
+        const size_t indice = tamano_.fetch_add(1, std::memory_order_relaxed);
+        const auto [k, desplazamiento] = ubicar(indice);
+        Segmento *segmento = obtenerSegmento(k);
+        std::construct_at(segmento->datos + desplazamiento, std::forward<Args>(args)...);
+        segmento->listos[desplazamiento].store(true, std::memory_order_release);
+        return indice;
+    }
+
+    /**
+     * @brief Crea por adelantado los segmentos necesarios para `n` elementos.
+     */
+    void reservar(size_t n) {
+        if (n == 0) return;
+        const size_t ultimo = ubicar(n - 1).first;
+        for (size_t k = 0; k <= ultimo; ++k) {
+            obtenerSegmento(k);
+        }
+    }
+
+    //
+    //  LECTURA CONCURRENTE
+    //
+
+    /**
+     * @brief Indica si el elemento `indice` ya fue construido y es visible para este hilo.
+     */
+    bool estaPublicado(size_t indice) const noexcept {
+        if (indice >= tamano_.load(std::memory_order_acquire)) return false;
+        const auto [k, desplazamiento] = ubicar(indice);
+        const Segmento *segmento = segmentos_[k].load(std::memory_order_acquire);
+        return segmento && segmento->listos[desplazamiento].load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Accede a un elemento publicado (no verificado).
+     *
+     * El elemento debe estar publicado: devuelto por `agregarFinal` a un hilo que se sincronizó
+     * con este, o confirmado con `estaPublicado`.
+     */
+    tipodato &operator[](size_t indice) noexcept {
+        const auto [k, desplazamiento] = ubicar(indice);
+        return segmentos_[k].load(std::memory_order_acquire)->datos[desplazamiento];
+    }
+
+    const tipodato &operator[](size_t indice) const noexcept {
+        const auto [k, desplazamiento] = ubicar(indice);
+        return segmentos_[k].load(std::memory_order_acquire)->datos[desplazamiento];
+    }
+
+    /**
+     * @brief Devuelve el elemento ubicado en un índice, verificando que esté publicado.
+     * @throws std::out_of_range si el índice no está reservado o todavía se está construyendo.
+     */
+    tipodato &en(size_t indice) {
+        if (!estaPublicado(indice)) {
+            throw std::out_of_range("Indice fuera de rango");
+        }
+        return (*this)[indice];
+    }
+
+    const tipodato &en(size_t indice) const {
+        if (!estaPublicado(indice)) {
+            throw std::out_of_range("Indice fuera de rango");
+        }
+        return (*this)[indice];
+    }
+
+    /**
+     * @brief Posiciones reservadas; con productores activos puede incluir elementos aún en construcción.
+     */
+    [[nodiscard]] size_t obtenerTamano() const noexcept {
+        return tamano_.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] bool vacio() const noexcept {
+        return obtenerTamano() == 0;
+    }
+
+    /**
+     * @brief Posiciones disponibles en los segmentos ya creados.
+     */
+    [[nodiscard]] size_t obtenerCapacidad() const noexcept {
+        size_t capacidad = 0;
+        for (const auto &segmento : segmentos_) {
+            if (const Segmento *s = segmento.load(std::memory_order_acquire)) {
+                capacidad += s->capacidad;
+            }
+        }
+        return capacidad;
+    }
+
+    //
+    //  OPERACIONES EXCLUSIVAS
+    //
+
+    /**
+     * @brief Mueve todos los elementos, en orden, al final de un Vector contiguo.
+     *
+     * Requiere que no haya productores activos. Las posiciones que nunca se publicaron (un
+     * constructor lanzó una excepción) se omiten. Los segmentos se conservan para la siguiente
+     * ronda de ingesta.
+     *
+     * @param destino Vector que recibe los elementos.
+     * @return Cantidad de elementos movidos.
+     */
+    template<typename Allocator>
+    size_t drenarEn(Vector<tipodato, Allocator> &destino) {
+        const size_t n = tamano_.load(std::memory_order_acquire);
+        destino.reservar(destino.obtenerTamano() + n);
+        size_t movidos = 0;
+        for (size_t i = 0; i < n; ++i) {
+            if (estaPublicado(i)) {
+                destino.agregarFinal(std::move((*this)[i]));
+                ++movidos;
+            }
+        }
+        vaciar();
+        return movidos;
+    }
+
+    /**
+     * @brief Destruye todos los elementos sin liberar los segmentos; requiere acceso exclusivo.
+     */
+    void vaciar() {
+        const size_t n = tamano_.load(std::memory_order_acquire);
+        for (size_t i = 0; i < n; ++i) {
+            const auto [k, desplazamiento] = ubicar(i);
+            Segmento *segmento = segmentos_[k].load(std::memory_order_relaxed);
+            if (segmento && segmento->listos[desplazamiento].load(std::memory_order_relaxed)) {
+                std::destroy_at(segmento->datos + desplazamiento);
+                segmento->listos[desplazamiento].store(false, std::memory_order_relaxed);
+            }
+        }
+        tamano_.store(0, std::memory_order_release);
+    }
+
+    /**
+     * @brief Aplica una función a cada elemento publicado, en orden de índice.
+     */
+    template<typename Funcion>
+    void paraCada(Funcion &&funcion) const {
+        const size_t n = obtenerTamano();
+        for (size_t i = 0; i < n; ++i) {
+            if (estaPublicado(i)) {
+                funcion((*this)[i]);
+            }
+        }
+    }
+
+    /** @name Métodos compatibles con std::vector
+    *Métodos alternativos con nombres en inglés para facilitar la interoperabilidad.
+    */
+    ///@{
+
+    size_t push_back(const tipodato &value) {
+        return agregarFinal(value);
+    }
+    size_t push_back(tipodato &&value) {
+        return agregarFinal(std::move(value));
+    }
+    void reserve(size_t n) {
+        reservar(n);
+    }
+    bool is_published(size_t index) const noexcept {
+        return estaPublicado(index);
+    }
+    tipodato &at(size_t index) {
+        return en(index);
+    }
+    const tipodato &at(size_t index) const {
+        return en(index);
+    }
+    [[nodiscard]] size_t size() const noexcept {
+        return obtenerTamano();
+    }
+    [[nodiscard]] bool empty() const noexcept {
+        return vacio();
+    }
+    [[nodiscard]] size_t capacity() const noexcept {
+        return obtenerCapacidad();
+    }
+    /**
+    * @brief Moves every element, in order, to the end of a contiguous Vector. Not thread-safe.
+    */
+    template<typename Allocator>
+    size_t drain_to(Vector<tipodato, Allocator> &destination) {
+        return drenarEn(destination);
+    }
+    void clear() {
+        vaciar();
+    }
+    template<typename Function>
+    void for_each(Function &&function) const {
+        paraCada(std::forward<Function>(function));
+    }
+
+    ///@}
+
+private:
+    /**
+     * @brief Segmento y posición dentro del segmento para un índice global.
+     */
+    static std::pair<size_t, size_t> ubicar(size_t indice) noexcept {
+        const size_t j = indice + primerSegmento_;
+        const size_t k = static_cast<size_t>(std::bit_width(j)) - 1 - bitsPrimerSegmento_;
+        return {k, j - (primerSegmento_ << k)};
+    }
+
+    /**
+     * @brief Devuelve el segmento k, creándolo si aún no existe.
+     */
+    Segmento *obtenerSegmento(size_t k) {
+        Segmento *segmento = segmentos_[k].load(std::memory_order_acquire);
+        if (segmento) return segmento;
+
+        const size_t capacidad = primerSegmento_ << k;
+        std::allocator<tipodato> alloc;
+        auto nuevo = std::make_unique<Segmento>();
+        nuevo->capacidad = capacidad;
+        nuevo->listos = std::make_unique<std::atomic<bool>[]>(capacidad);
+        nuevo->datos = alloc.allocate(capacidad);
+
+        if (segmentos_[k].compare_exchange_strong(segmento, nuevo.get(),
+                                                  std::memory_order_acq_rel, std::memory_order_acquire)) {
+            return nuevo.release();
+        }
+        alloc.deallocate(nuevo->datos, capacidad);
+        return segmento;
+    }
+
+    static void liberarSegmento(Segmento *segmento) {
+        if (!segmento) return;
+        std::allocator<tipodato>().deallocate(segmento->datos, segmento->capacidad);
+        delete segmento;
+    }
+};
+
+#endif //CONCURRENTVECTOR_H
@@ -0,0 +1,184 @@
+/**
+ * @file coroutines.h
+ * @brief Generador de corrutinas para alimentar y recorrer Vector por bloques
+ *
+ * Generador<T> es un generador sincrono minimo (co_yield) que funciona como rango de entrada,
+ * para compiladores sin std::generator. Junto con `Vector::agregarDesde` permite encadenar un
+ * productor (por ejemplo, un parser) con el almacenamiento sin buffers intermedios:
+ *
+ *     v.agregarDesde(leerNumeros(texto), 4096);
+ *
+ * En la otra direccion, `transmitirBloques` recorre un Vector en bloques de tamaño fijo como
+ * VectorView, sin copiar, para consumidores que procesan por bloques.
+ *
+ * @include coroutine
+ * @include exception
+ * @include iterator
+ * @include utility
+ * @include cppvector.h
+ *
+ * @author Marian
+ * @date May 31st, 2025
+ *
+ **/
+
+#ifndef COROUTINES_H
+#define COROUTINES_H
+
+#include <coroutine>
+#include <exception>
+#include <iterator>
+#include <utility>
+#include "cppvector.h"
+
+/**
+* @brief Tipos de corrutinas para producir y consumir elementos de Vector.
+*/
+namespace cppvector_corrutinas {
+
+    /**
+    * @struct Generador
+    * @brief Generador perezoso de valores con co_yield; se recorre una sola vez.
+    *
+    * El cuerpo de la corrutina se ejecuta hasta el siguiente co_yield cada vez que se avanza
+    * el iterador. Una excepción lanzada dentro del generador se propaga a quien lo recorre.
+    * El valor producido es válido hasta que se avance el iterador.
+    *
+    * @tparam tipodato Tipo de los valores producidos
+    */
+    template<typename tipodato>
+    struct Generador {
+        struct promise_type {
+            const tipodato *actual_ = nullptr;      /// < Valor del ultimo co_yield
+            std::exception_ptr excepcion_;
+
+            Generador get_return_object() noexcept {
+                return Generador(std::coroutine_handle<promise_type>::from_promise(*this));
+            }
+            std::suspend_always initial_suspend() const noexcept { return {}; }
+            std::suspend_always final_suspend() const noexcept { return {}; }
+
+            /**
+            * @brief Guarda la dirección del valor: un temporal vive hasta que la corrutina se reanuda.
+            */
+            std::suspend_always yield_value(const tipodato &valor) noexcept {
+                actual_ = std::addressof(valor);
+                return {};
+            }
+            void return_void() const noexcept {}
+            void unhandled_exception() noexcept {
+                excepcion_ = std::current_exception();
+            }
+
+            // co_await no tiene sentido en un generador sincrono
+            template<typename U>
+            std::suspend_never await_transform(U &&) = delete;
+        };
+
+        using Handle = std::coroutine_handle<promise_type>;
+
+        /**
+        * @struct Iterator
+        * @brief Iterador de entrada que reanuda la corrutina al avanzar.
+        */
+        struct Iterator {
+            using iterator_category = std::input_iterator_tag;
+            using value_type = tipodato;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const tipodato *;
+            using reference = const tipodato &;
+
+            Handle corrutina_ = nullptr;
+
+            reference operator*() const noexcept { return *corrutina_.promise().actual_; }
+            pointer operator->() const noexcept { return corrutina_.promise().actual_; }
+
+            Iterator &operator++() {
+                reanudar(corrutina_);
+                return *this;
+            }
+            void operator++(int) { ++*this; }
+
+            bool operator==(std::default_sentinel_t) const noexcept {
+                return !corrutina_ || corrutina_.done();
+            }
+        };
+
+        Generador() noexcept = default;
+        Generador(Generador &&otro) noexcept : corrutina_(std::exchange(otro.corrutina_, nullptr)) {}
+        Generador &operator=(Generador &&otro) noexcept {
+            if (this != &otro) {
+                if (corrutina_) corrutina_.destroy();
+                corrutina_ = std::exchange(otro.corrutina_, nullptr);
+            }
+            return *this;
+        }
+        Generador(const Generador &) = delete;
+        Generador &operator=(const Generador &) = delete;
+
+        ~Generador() {
+            if (corrutina_) corrutina_.destroy();
+        }
+
+        /**
+        * @brief Ejecuta la corrutina hasta el primer co_yield y devuelve el iterador.
+        */
+        Iterator begin() {
+            reanudar(corrutina_);
+            return Iterator{corrutina_};
+        }
+
+        std::default_sentinel_t end() const noexcept {
+            return {};
+        }
+
+    private:
+        explicit Generador(Handle corrutina) noexcept : corrutina_(corrutina) {}
+
+        static void reanudar(Handle corrutina) {
+            if (!corrutina || corrutina.done()) return;
+            corrutina.resume();
+            if (corrutina.promise().excepcion_) {
+                std::rethrow_exception(std::exchange(corrutina.promise().excepcion_, nullptr));
+            }
+        }
+
+        Handle corrutina_ = nullptr;
+    };
+
+    /**
+    * @brief Recorre `v` en bloques consecutivos de `tamanoBloque` elementos (el último puede ser menor).
+    *
+    * Cada bloque es un VectorView sobre la memoria de `v`, así que no se copia nada; `v` no debe
+    * modificarse mientras se recorre.
+    *
+    * @throws std::invalid_argument si tamanoBloque es 0 (al empezar a recorrerlo).
+    */
+    template<typename tipodato, typename Allocator>
+    Generador<VectorView<tipodato>> transmitirBloques(const Vector<tipodato, Allocator> &v, size_t tamanoBloque) {
+        if (tamanoBloque == 0) throw std::invalid_argument("El tamaño de bloque debe ser mayor que 0");
+        for (size_t desde = 0; desde < v.obtenerTamano(); desde += tamanoBloque) {
+            co_yield v.subvectorVista(desde, std::min(v.obtenerTamano(), desde + tamanoBloque));
+        }
+    }
+
+    /** @name Nombres en inglés
+    *Alias con nombres en inglés para facilitar la interoperabilidad.
+    */
+    ///@{
+
+    template<typename T>
+    using generator = Generador<T>;
+
+    /**
+    * @brief Yields zero-copy VectorView chunks of `chunkSize` elements over `v`.
+    */
+    template<typename tipodato, typename Allocator>
+    Generador<VectorView<tipodato>> stream_chunks(const Vector<tipodato, Allocator> &v, size_t chunkSize) {
+        return transmitirBloques(v, chunkSize);
+    }
+
+    ///@}
+}
+
+#endif //COROUTINES_H
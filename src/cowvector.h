@@ -0,0 +1,595 @@
+/**
+ * @file cowvector.h
+ * @brief Vector con copia en escritura (copy-on-write) para instantaneas baratas
+ *
+ * CowVector envuelve un Vector en un bloque compartido con contador de referencias atomico.
+ * Copiar un CowVector es O(1): ambas copias comparten el mismo buffer hasta que una de ellas
+ * se modifica, momento en el que esa copia clona los datos una unica vez.
+ *
+ * @include atomic
+ * @include cppvector.h
+ *
+ * @author Marian
+ * @date May 31st, 2025
+ *
+ **/
+
+#ifndef COWVECTOR_H
+#define COWVECTOR_H
+
+#include <atomic>
+#include "cppvector.h"
+
+/**
+* @struct CowVector
+* @brief Vector con copia en escritura y contador de referencias atomico.
+*
+* Las lecturas (`operator[]` const, `contiene`, `buscar`, `contar`, iteradores constantes...)
+* acceden directamente al buffer compartido. Cualquier metodo que modifique el contenido
+* clona primero el buffer si otra copia lo esta usando.
+*
+* Las copias pueden pasarse entre hilos: el contador es atomico y el buffer compartido es
+* inmutable. Un mismo CowVector no debe modificarse desde varios hilos a la vez.
+*
+* @note Obtener una referencia o puntero mutable (`operator[]` no const, `en`, `data`,
+*       `modificar`...) marca la instancia como no compartible: las copias posteriores
+*       hacen una copia profunda, de modo que esa referencia nunca altera una instantanea.
+*       Cuando ya no se usan esas referencias, `compartir()` vuelve a permitir copias O(1).
+*
+* @tparam tipodato Tipo de dato almacenado
+*/
+template<typename tipodato, typename Allocator = std::allocator<tipodato> >
+struct CowVector {
+    using vector_type = Vector<tipodato, Allocator>;
+
+private:
+    /**
+     * @brief Bloque compartido entre copias.
+     */
+    struct Bloque {
+        std::atomic<size_t> referencias;    /// < Cantidad de CowVector que comparten el bloque
+        vector_type datos;                  /// < Contenido compartido
+
+        explicit Bloque(const vector_type &v) : referencias(1), datos(v) {}
+        explicit Bloque(vector_type &&v) : referencias(1), datos(std::move(v)) {}
+    };
+
+    Bloque *bloque_;        /// < Bloque compartido (nullptr si esta vacio)
+    bool compartible_;      /// < false si se entrego una referencia mutable al contenido
+
+public:
+    using value_type = tipodato;
+    using reference = tipodato&;
+    using const_reference = const tipodato&;
+    using const_iterator = const tipodato*;
+
+    CowVector() noexcept : bloque_(nullptr), compartible_(true) {}
+
+    /**
+     * @brief Constructor para la initializer list
+     * @param lista
+     */
+    CowVector(std::initializer_list<tipodato> lista) : bloque_(new Bloque(vector_type(lista))), compartible_(true) {}
+
+    /**
+     * @brief Construye a partir de una copia de un Vector.
+     * @param v
+     */
+    explicit CowVector(const vector_type &v) : bloque_(new Bloque(v)), compartible_(true) {}
+
+    /**
+     * @brief Construye tomando posesion del buffer de un Vector (sin copiar elementos).
+     * @param v
+     */
+    explicit CowVector(vector_type &&v) : bloque_(new Bloque(std::move(v))), compartible_(true) {}
+
+    /**
+     * @brief Constructor de copia, O(1) salvo que el origen no sea compartible.
+     * @param otro
+     */
+    CowVector(const CowVector &otro) : bloque_(nullptr), compartible_(true) {
+        if (otro.bloque_ == nullptr) return;
+        if (otro.compartible_) {
+            otro.bloque_->referencias.fetch_add(1, std::memory_order_relaxed);
+            bloque_ = otro.bloque_;
+        } else {
+            bloque_ = new Bloque(otro.bloque_->datos);
+        }
+    }
+
+    /**
+     * @brief Constructor para move semantics
+     * @param otro
+     */
+    CowVector(CowVector &&otro) noexcept : bloque_(otro.bloque_), compartible_(otro.compartible_) {
+        otro.bloque_ = nullptr;
+        otro.compartible_ = true;
+    }
+
+    /**
+     * @brief Destructor, libera el bloque si era la ultima referencia.
+     */
+    ~CowVector() {
+        liberar();
+    }
+
+    /**
+     * @brief Operador de copia
+     * @param otro
+     * @return
+     */
+    CowVector &operator=(const CowVector &otro) {
+        if (this != &otro) {
+            CowVector temp(otro);
+            intercambiar(temp);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Operador de asignacion
+     * @param otro
+     * @return
+     */
+    CowVector &operator=(CowVector &&otro) noexcept {
+        if (this != &otro) {
+            liberar();
+            bloque_ = otro.bloque_;
+            compartible_ = otro.compartible_;
+            otro.bloque_ = nullptr;
+            otro.compartible_ = true;
+        }
+        return *this;
+    }
+
+    //
+    //  LECTURA (sin copia)
+    //
+
+    /**
+     * @brief Devuelve el Vector compartido en modo solo lectura.
+     * @return Referencia constante al contenido.
+     */
+    const vector_type &leer() const noexcept {
+        return bloque_ ? bloque_->datos : vacioCompartido();
+    }
+
+    /**
+    * @brief Accede a un valor por índice (no verificado).
+    * @param indice Índice del valor.
+    * @return Referencia constante al valor.
+    */
+    const tipodato &operator[](size_t indice) const {
+        return leer()[indice];
+    }
+
+    /**
+     * @brief Devuelve el valor ubicado en un índice específico.
+     * @param indice Índice del valor.
+     * @return Referencia constante al valor.
+     * @throws std::out_of_range si el índice es inválido.
+     */
+    const tipodato &en(size_t indice) const {
+        return leer().en(indice);
+    }
+
+    /**
+     * @brief Verifica si el vector está ordenado.
+     * @return true si el vector está ordenado.
+     */
+    [[nodiscard]] bool estaOrdenado() const {
+        return leer().estaOrdenado();
+    }
+
+    /**
+     * @brief Verifica si el vector está vacío.
+     * @return true si el tamaño es 0.
+     */
+    [[nodiscard]] bool vacio() const {
+        return leer().vacio();
+    }
+
+    /**
+    * @brief Devuelve el tamaño actual del vector.
+    * @return Tamaño del vector.
+    */
+    [[nodiscard]] size_t obtenerTamano() const {
+        return leer().obtenerTamano();
+    }
+
+    /**
+    * @brief Devuelve cuántos CowVector comparten el buffer actual.
+    * @return Número de referencias (0 si el vector está vacío).
+    */
+    [[nodiscard]] size_t referencias() const {
+        return bloque_ ? bloque_->referencias.load(std::memory_order_acquire) : 0;
+    }
+
+    /**
+    * @brief Verifica si el vector contiene un valor.
+    * @param dato Valor a buscar.
+    * @return true si se encuentra el valor.
+    */
+    bool contiene(const tipodato &dato) const {
+        return leer().contiene(dato);
+    }
+
+    /**
+    * @brief Busca un valor en el vector.
+    * @param dato Valor a buscar.
+    * @return Índice del valor si se encuentra, -1 en caso contrario.
+    */
+    int buscar(const tipodato &dato) const {
+        return leer().buscar(dato);
+    }
+
+    /**
+    * @brief Cuenta cuántas veces aparece un dato en el vector.
+    * @param dato Valor a contar.
+    * @return Número de apariciones del valor.
+    */
+    size_t contar(const tipodato &dato) const {
+        return leer().contar(dato);
+    }
+
+    /**
+     * @brief Iterador constante al inicio del buffer compartido.
+     */
+    const tipodato *begin() const noexcept {
+        return leer().data();
+    }
+
+    /**
+     * @brief Iterador constante al final del buffer compartido.
+     */
+    const tipodato *end() const noexcept {
+        return leer().data() + leer().obtenerTamano();
+    }
+
+    const tipodato *cbegin() const noexcept { return begin(); }
+    const tipodato *cend() const noexcept { return end(); }
+
+    /**
+    * @brief Operador de salida.
+    * @param os Flujo de salida.
+    * @param v Vector a imprimir.
+    * @return Referencia al flujo de salida.
+    */
+    friend std::ostream &operator<<(std::ostream &os, const CowVector &v) {
+        return os << v.leer();
+    }
+
+    bool operator==(const CowVector &otro) const {
+        return bloque_ == otro.bloque_ || leer() == otro.leer();
+    }
+
+    bool operator!=(const CowVector &otro) const {
+        return !(*this == otro);
+    }
+
+    //
+    //  ESCRITURA (clona si el buffer esta compartido)
+    //
+
+    /**
+     * @brief Devuelve el Vector propio para modificarlo, clonandolo si estaba compartido.
+     *
+     * Marca la instancia como no compartible mientras la referencia pueda seguir en uso.
+     *
+     * @return Referencia mutable al contenido.
+     */
+    vector_type &modificar() {
+        separar();
+        compartible_ = false;
+        return bloque_->datos;
+    }
+
+    /**
+     * @brief Vuelve a permitir copias O(1) tras haber entregado referencias mutables.
+     *
+     * Debe llamarse solo cuando ya no se usa ninguna referencia, puntero o iterador mutable
+     * obtenido antes (con `modificar`, `operator[]` no const, `en` o `data`): si no, escribir
+     * por él alteraría también las copias que compartan el buffer.
+     */
+    void compartir() noexcept {
+        compartible_ = true;
+    }
+
+    /**
+     * @brief Indica si copiar este vector es O(1) (no hay referencias mutables entregadas).
+     */
+    [[nodiscard]] bool esCompartible() const noexcept {
+        return compartible_;
+    }
+
+    /**
+     * @brief Accede a un valor por índice (no verificado) para modificarlo.
+     * @param indice Índice del valor.
+     * @return Referencia al valor.
+     */
+    tipodato &operator[](size_t indice) {
+        return modificar()[indice];
+    }
+
+    /**
+     * @brief Devuelve el valor ubicado en un índice específico para modificarlo.
+     * @param indice Índice del valor.
+     * @return Referencia al valor.
+     * @throws std::out_of_range si el índice es inválido.
+     */
+    tipodato &en(size_t indice) {
+        if (indice >= obtenerTamano()) {
+            throw std::out_of_range("Indice fuera de rango");
+        }
+        return modificar()[indice];
+    }
+
+    /**
+     * @brief Agrega un valor al final del vector.
+     * @param dato Valor a agregar.
+     */
+    void agregarFinal(const tipodato &dato) {
+        separar();
+        bloque_->datos.agregarFinal(dato);
+    }
+
+    /**
+     * @brief Agrega un valor al final del vector.
+     * @param dato Valor a agregar.
+     */
+    void agregarFinal(tipodato &&dato) {
+        separar();
+        bloque_->datos.agregarFinal(std::move(dato));
+    }
+
+    /**
+     * @brief Construye un objeto al final del vector.
+     * @param args Argumentos para el constructor de tipodato.
+     */
+    template<typename... Args>
+    void emplace_back(Args&&... args) {
+        separar();
+        bloque_->datos.emplace_back(std::forward<Args>(args)...);
+    }
+
+    /**
+    * @brief Inserta un valor en el índice especificado.
+    * @param indice Índice donde se insertará el valor.
+    * @param dato Valor a insertar.
+    * @throws std::out_of_range si el índice está fuera de rango.
+    */
+    void insertar(size_t indice, const tipodato &dato) {
+        separar();
+        bloque_->datos.insertar(indice, dato);
+    }
+
+    /**
+    * @brief Elimina el elemento ubicado en el índice dado.
+    * @param indice Índice del elemento a eliminar.
+    * @throws std::out_of_range si el índice está fuera de rango.
+    */
+    void eliminar(size_t indice) {
+        separar();
+        bloque_->datos.eliminar(indice);
+    }
+
+    /**
+     * @brief Elimina el último elemento del vector.
+     * @throws std::out_of_range si el vector está vacío.
+     */
+    void eliminarFinal() {
+        separar();
+        bloque_->datos.eliminarFinal();
+    }
+
+    /**
+    * @brief Reemplaza todas las apariciones de un dato por otro.
+    *
+    * Si el dato no aparece no se clona el buffer.
+    *
+    * @param dato Valor a reemplazar.
+    * @param nuevo Nuevo valor.
+    */
+    void reemplazar(const tipodato &dato, const tipodato &nuevo) {
+        if (!contiene(dato)) return;
+        separar();
+        bloque_->datos.reemplazar(dato, nuevo);
+    }
+
+    /**
+    * @brief Ordena el vector. No clona el buffer si ya estaba ordenado.
+    */
+    void ordenar() {
+        if (estaOrdenado()) return;
+        separar();
+        bloque_->datos.ordenar();
+    }
+
+    /**
+    * @brief Invierte el orden de los elementos en el vector.
+    */
+    void invertir() {
+        if (obtenerTamano() <= 1) return;
+        separar();
+        bloque_->datos.invertir();
+    }
+
+    /**
+    * @brief Elimina todos los elementos duplicados del vector.
+    */
+    void eliminarDuplicados() {
+        if (obtenerTamano() <= 1) return;
+        separar();
+        bloque_->datos.eliminarDuplicados();
+    }
+
+    /**
+    * @brief Redimensiona el vector.
+    * @param nuevoTam Nuevo tamaño.
+    * @param dato Valor con el que se rellenan los nuevos elementos.
+    */
+    void redimensionar(size_t nuevoTam, const tipodato &dato = tipodato()) {
+        if (nuevoTam == obtenerTamano()) return;
+        separar();
+        bloque_->datos.redimensionar(nuevoTam, dato);
+    }
+
+    /**
+    * @brief Reserva una nueva capacidad para el vector propio.
+    * @param nuevaCapacidad Nueva capacidad deseada.
+    */
+    void reservar(size_t nuevaCapacidad) {
+        separar();
+        bloque_->datos.reservar(nuevaCapacidad);
+    }
+
+    /**
+     * @brief Vacía el vector. Si el buffer estaba compartido solo se suelta la referencia.
+     */
+    void vaciar() {
+        liberar();
+        bloque_ = nullptr;
+        compartible_ = true;
+    }
+
+    /**
+    * @brief Intercambia el contenido de este vector con otro (O(1)).
+    * @param otro Vector con el cual se intercambiarán los datos.
+    */
+    void intercambiar(CowVector &otro) noexcept {
+        std::swap(bloque_, otro.bloque_);
+        std::swap(compartible_, otro.compartible_);
+    }
+
+    /** @name Métodos compatibles con std::vector
+    *Métodos alternativos con nombres en inglés para facilitar la interoperabilidad.
+    */
+    ///@{
+
+    /**
+    * @brief Returns the shared Vector as read-only.
+    */
+    const vector_type &view() const noexcept {
+        return leer();
+    }
+    /**
+    * @brief Returns a mutable reference to an unshared Vector, cloning it if needed.
+    */
+    vector_type &mutate() {
+        return modificar();
+    }
+    /**
+    * @brief Re-enables O(1) copies once no mutable reference handed out earlier is in use.
+    */
+    void share() noexcept {
+        compartir();
+    }
+    [[nodiscard]] bool is_shareable() const noexcept {
+        return esCompartible();
+    }
+    /**
+    * @brief Returns the number of CowVectors sharing the current buffer.
+    */
+    [[nodiscard]] size_t use_count() const {
+        return referencias();
+    }
+    const tipodato &at(size_t index) const {
+        return en(index);
+    }
+    tipodato &at(size_t index) {
+        return en(index);
+    }
+    const tipodato *data() const noexcept {
+        return begin();
+    }
+    tipodato *data() {
+        return modificar().data();
+    }
+    [[nodiscard]] size_t size() const {
+        return obtenerTamano();
+    }
+    [[nodiscard]] bool empty() const {
+        return vacio();
+    }
+    [[nodiscard]] bool isSorted() const {
+        return estaOrdenado();
+    }
+    void push_back(const tipodato &value) {
+        agregarFinal(value);
+    }
+    void push_back(tipodato &&value) {
+        agregarFinal(std::move(value));
+    }
+    void pop_back() {
+        eliminarFinal();
+    }
+    void insert(size_t index, const tipodato &value) {
+        insertar(index, value);
+    }
+    void erase(size_t index) {
+        eliminar(index);
+    }
+    void replace_all(const tipodato &oldValue, const tipodato &newValue) {
+        reemplazar(oldValue, newValue);
+    }
+    void sort() {
+        ordenar();
+    }
+    void reverse() {
+        invertir();
+    }
+    void remove_duplicates() {
+        eliminarDuplicados();
+    }
+    void resize(size_t newSize, const tipodato &value = tipodato()) {
+        redimensionar(newSize, value);
+    }
+    void reserve(size_t newCapacity) {
+        reservar(newCapacity);
+    }
+    void clear() {
+        vaciar();
+    }
+    void swap(CowVector &other) noexcept {
+        intercambiar(other);
+    }
+
+    ///@}
+
+private:
+    /**
+     * @brief Garantiza que este CowVector sea el unico dueño de su bloque.
+     *
+     * Si el bloque esta compartido se clona el Vector (una copia por escritura) y se
+     * suelta la referencia al original.
+     */
+    void separar() {
+        if (bloque_ == nullptr) {
+            bloque_ = new Bloque(vector_type{});
+            return;
+        }
+        if (bloque_->referencias.load(std::memory_order_acquire) == 1) {
+            return;
+        }
+        Bloque *copia = new Bloque(bloque_->datos);
+        liberar();
+        bloque_ = copia;
+    }
+
+    /**
+     * @brief Suelta la referencia al bloque actual y lo destruye si era la ultima.
+     */
+    void liberar() noexcept {
+        if (bloque_ && bloque_->referencias.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete bloque_;
+        }
+        bloque_ = nullptr;
+    }
+
+    static const vector_type &vacioCompartido() noexcept {
+        static const vector_type vacio;
+        return vacio;
+    }
+};
+
+#endif //COWVECTOR_H
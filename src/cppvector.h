@@ -8,9 +8,14 @@
  *
  * @include iostream
  * @include algorithm
+ * @include charconv
+ * @include cstdio
  * @include cstring
+ * @include immintrin.h (si hay AVX2/SSE2)
  * @include limits
  * @include stdexcept
+ * @include string_view
+ * @include threadpool.h
  *
  * @author Marian
  * @date May 31st, 2025
@@ -22,14 +27,28 @@
 
 #include <iostream>
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <cassert>
+#include <charconv>
+#include <cstdint>
+#include <cstdio>
 #include <cstring>
 #include <limits>
 #include <stdexcept>
 #include <ranges>
 #include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
 #include <vector>
 
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+#include "threadpool.h"
+
 /**
 * @brief Compara la igualdad entre dos valores.
 *
@@ -49,15 +68,773 @@
 */
 
 template<typename T>
-std::enable_if_t<!std::is_floating_point_v<T>, bool>
+constexpr std::enable_if_t<!std::is_floating_point_v<T>, bool>
 areEqual(const T& a, const T& b) {
     return a == b;
 }
 
 template<typename T>
-std::enable_if_t<std::is_floating_point_v<T>, bool>
+constexpr std::enable_if_t<std::is_floating_point_v<T>, bool>
 areEqual(const T& a, const T& b) {
-    return std::abs(a - b) <= std::numeric_limits<T>::epsilon();
+    // |a - b| sin std::abs, que no es constexpr hasta C++23
+    return (a < b ? b - a : a - b) <= std::numeric_limits<T>::epsilon();
+}
+
+/**
+* @brief Kernels SIMD usados internamente por Vector.
+*
+* Cada kernel procesa la parte del arreglo que cabe en registros vectoriales y devuelve
+* cuántos elementos (o pares de elementos) procesó; el llamador completa la cola con un
+* bucle escalar. Sin AVX2/SSE2 disponibles los kernels no procesan nada.
+*/
+namespace cppvector_simd {
+
+    /// Tipos aritméticos (excepto bool) de 1, 2, 4 u 8 bytes, aptos para comparar en registros.
+    template<typename T>
+    inline constexpr bool es_aritmetico_v = std::is_arithmetic_v<T> && !std::is_same_v<T, bool> &&
+        (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
+    /// Tipos que se pueden reordenar copiando sus bytes en bloques de 1, 2, 4 u 8 bytes.
+    template<typename T>
+    inline constexpr bool es_reordenable_v = std::is_trivially_copyable_v<T> &&
+        (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
+#if defined(__AVX2__)
+    inline constexpr size_t bytes_registro = 32;
+    using registro = __m256i;
+
+    inline registro cargar(const void* p) { return _mm256_loadu_si256(static_cast<const __m256i*>(p)); }
+    inline void guardar(void* p, registro v) { _mm256_storeu_si256(static_cast<__m256i*>(p), v); }
+#elif defined(__SSE2__)
+    inline constexpr size_t bytes_registro = 16;
+    using registro = __m128i;
+
+    inline registro cargar(const void* p) { return _mm_loadu_si128(static_cast<const __m128i*>(p)); }
+    inline void guardar(void* p, registro v) { _mm_storeu_si128(static_cast<__m128i*>(p), v); }
+#else
+    inline constexpr size_t bytes_registro = 0;
+#endif
+
+#if defined(__AVX2__) || defined(__SSE2__)
+    /// Indica si hay comparación vectorial de igualdad para T en el conjunto de instrucciones activo.
+    template<typename T>
+    inline constexpr bool comparable_v = es_aritmetico_v<T>
+#if !defined(__AVX2__) && !defined(__SSE4_1__)
+        && (std::is_floating_point_v<T> || sizeof(T) < 8)
+#endif
+        ;
+
+    /// Indica si hay permutación vectorial para invertir elementos de `Ancho` bytes.
+    template<size_t Ancho>
+    inline constexpr bool invertible_v = Ancho == 2 || Ancho == 4 || Ancho == 8
+#if defined(__AVX2__) || defined(__SSSE3__)
+        || Ancho == 1
+#endif
+        ;
+
+    /// Compara un registro contra un valor difundido; devuelve una máscara con 1s donde son iguales.
+    template<typename T>
+    inline registro mascaraIgual(registro v, T dato) {
+#if defined(__AVX2__)
+        if constexpr (std::is_same_v<T, float>) {
+            return _mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(v), _mm256_set1_ps(dato), _CMP_EQ_OQ));
+        } else if constexpr (std::is_same_v<T, double>) {
+            return _mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(v), _mm256_set1_pd(dato), _CMP_EQ_OQ));
+        } else if constexpr (sizeof(T) == 1) {
+            return _mm256_cmpeq_epi8(v, _mm256_set1_epi8(static_cast<char>(dato)));
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm256_cmpeq_epi16(v, _mm256_set1_epi16(static_cast<short>(dato)));
+        } else if constexpr (sizeof(T) == 4) {
+            return _mm256_cmpeq_epi32(v, _mm256_set1_epi32(static_cast<int>(dato)));
+        } else {
+            return _mm256_cmpeq_epi64(v, _mm256_set1_epi64x(static_cast<long long>(dato)));
+        }
+#else
+        if constexpr (std::is_same_v<T, float>) {
+            return _mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(v), _mm_set1_ps(dato)));
+        } else if constexpr (std::is_same_v<T, double>) {
+            return _mm_castpd_si128(_mm_cmpeq_pd(_mm_castsi128_pd(v), _mm_set1_pd(dato)));
+        } else if constexpr (sizeof(T) == 1) {
+            return _mm_cmpeq_epi8(v, _mm_set1_epi8(static_cast<char>(dato)));
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm_cmpeq_epi16(v, _mm_set1_epi16(static_cast<short>(dato)));
+        } else if constexpr (sizeof(T) == 4) {
+            return _mm_cmpeq_epi32(v, _mm_set1_epi32(static_cast<int>(dato)));
+        } else {
+#if defined(__SSE4_1__)
+            return _mm_cmpeq_epi64(v, _mm_set1_epi64x(static_cast<long long>(dato)));
+#else
+            return v;   // inalcanzable: comparable_v<T> es falso
+#endif
+        }
+#endif
+    }
+
+    /// Selecciona `b` donde la máscara está activa y `a` en el resto.
+    inline registro mezclar(registro a, registro b, registro mascara) {
+#if defined(__AVX2__)
+        return _mm256_blendv_epi8(a, b, mascara);
+#else
+        return _mm_or_si128(_mm_and_si128(mascara, b), _mm_andnot_si128(mascara, a));
+#endif
+    }
+
+    /// Comprime una máscara de comparación a un entero con un bit por byte.
+    inline unsigned bitsMascara(registro mascara) {
+#if defined(__AVX2__)
+        return static_cast<unsigned>(_mm256_movemask_epi8(mascara));
+#else
+        return static_cast<unsigned>(_mm_movemask_epi8(mascara));
+#endif
+    }
+
+    /// Difunde un valor de 1, 2, 4 u 8 bytes a todo el registro, preservando sus bits.
+    template<typename T>
+    inline registro difundir(const T& dato) {
+        unsigned char bytes[bytes_registro];
+        for (size_t i = 0; i < bytes_registro; i += sizeof(T)) {
+            std::memcpy(bytes + i, &dato, sizeof(T));
+        }
+        return cargar(bytes);
+    }
+
+    /// Invierte el orden de los elementos de `Ancho` bytes dentro de un registro.
+    template<size_t Ancho>
+    inline registro invertirRegistro(registro v) {
+#if defined(__AVX2__)
+        if constexpr (Ancho == 8) {
+            return _mm256_permute4x64_epi64(v, 0x1B);
+        } else if constexpr (Ancho == 4) {
+            return _mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+        } else if constexpr (Ancho == 2) {
+            v = _mm256_shuffle_epi8(v, _mm256_setr_epi8(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1,
+                                                        14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1));
+            return _mm256_permute2x128_si256(v, v, 0x01);
+        } else {
+            v = _mm256_shuffle_epi8(v, _mm256_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0,
+                                                        15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0));
+            return _mm256_permute2x128_si256(v, v, 0x01);
+        }
+#else
+        if constexpr (Ancho == 8) {
+            return _mm_shuffle_epi32(v, 0x4E);
+        } else if constexpr (Ancho == 4) {
+            return _mm_shuffle_epi32(v, 0x1B);
+        } else if constexpr (Ancho == 2) {
+            v = _mm_shufflelo_epi16(v, 0x1B);
+            v = _mm_shufflehi_epi16(v, 0x1B);
+            return _mm_shuffle_epi32(v, 0x4E);
+        } else {
+#if defined(__SSSE3__)
+            return _mm_shuffle_epi8(v, _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0));
+#else
+            return v;   // inalcanzable: invertible_v<1> es falso
+#endif
+        }
+#endif
+    }
+#endif
+
+    /**
+    * @brief Reemplaza en bloque las apariciones de `dato` por `nuevo` (comparación + mezcla).
+    * @return Cantidad de elementos procesados desde el inicio del arreglo.
+    */
+    template<typename T>
+    inline size_t reemplazar(T* datos, size_t n, const T& dato, const T& nuevo) {
+#if defined(__AVX2__) || defined(__SSE2__)
+        if constexpr (comparable_v<T>) {
+            constexpr size_t paso = bytes_registro / sizeof(T);
+            const registro valorNuevo = difundir(nuevo);
+            size_t i = 0;
+            for (; i + paso <= n; i += paso) {
+                const registro v = cargar(datos + i);
+                guardar(datos + i, mezclar(v, valorNuevo, mascaraIgual(v, dato)));
+            }
+            return i;
+        }
+#endif
+        (void) datos; (void) n; (void) dato; (void) nuevo;
+        return 0;
+    }
+
+    /**
+    * @brief Invierte en bloque los extremos del arreglo intercambiando registros invertidos.
+    * @return Cantidad de elementos procesados en cada extremo.
+    */
+    template<typename T>
+    inline size_t invertir(T* datos, size_t n) {
+#if defined(__AVX2__) || defined(__SSE2__)
+        if constexpr (es_reordenable_v<T> && invertible_v<sizeof(T)>) {
+            constexpr size_t paso = bytes_registro / sizeof(T);
+            size_t i = 0;
+            for (; 2 * (i + paso) <= n; i += paso) {
+                const registro izquierda = cargar(datos + i);
+                const registro derecha = cargar(datos + n - i - paso);
+                guardar(datos + i, invertirRegistro<sizeof(T)>(derecha));
+                guardar(datos + n - i - paso, invertirRegistro<sizeof(T)>(izquierda));
+            }
+            return i;
+        }
+#endif
+        (void) datos; (void) n;
+        return 0;
+    }
+
+    /**
+    * @brief Cuenta en bloque las apariciones de `dato` (comparación + popcount de la máscara).
+    * @param cuenta Se incrementa con las apariciones de la parte procesada.
+    * @return Cantidad de elementos procesados desde el inicio del arreglo.
+    */
+    template<typename T>
+    inline size_t contar(const T* datos, size_t n, const T& dato, size_t& cuenta) {
+#if defined(__AVX2__) || defined(__SSE2__)
+        if constexpr (comparable_v<T>) {
+            constexpr size_t paso = bytes_registro / sizeof(T);
+            size_t i = 0;
+            for (; i + paso <= n; i += paso) {
+                cuenta += static_cast<size_t>(std::popcount(bitsMascara(mascaraIgual(cargar(datos + i), dato)))) / sizeof(T);
+            }
+            return i;
+        }
+#endif
+        (void) datos; (void) n; (void) dato; (void) cuenta;
+        return 0;
+    }
+
+    /**
+    * @brief Busca en bloque la primera aparición de `dato`.
+    * @return Índice de la primera aparición si está en la parte procesada; si no, la cantidad
+    *         de elementos procesados (el llamador sigue desde ahí con un bucle escalar).
+    */
+    template<typename T>
+    inline size_t buscar(const T* datos, size_t n, const T& dato) {
+#if defined(__AVX2__) || defined(__SSE2__)
+        if constexpr (comparable_v<T>) {
+            constexpr size_t paso = bytes_registro / sizeof(T);
+            size_t i = 0;
+            for (; i + paso <= n; i += paso) {
+                const unsigned bits = bitsMascara(mascaraIgual(cargar(datos + i), dato));
+                if (bits != 0) {
+                    return i + static_cast<size_t>(std::countr_zero(bits)) / sizeof(T);
+                }
+            }
+            return i;
+        }
+#endif
+        (void) datos; (void) n; (void) dato;
+        return 0;
+    }
+}
+
+/**
+* @brief Lectura de números en texto delimitado (usado por Vector::analizar).
+*/
+namespace cppvector_texto {
+
+    /**
+    * @brief Error al leer un número: guarda la posición (en bytes desde el inicio) y la línea (desde 1).
+    */
+    struct ErrorAnalisis : std::invalid_argument {
+        size_t posicion;
+        size_t linea;
+
+        ErrorAnalisis(const char *motivo, size_t posicion, size_t linea)
+            : std::invalid_argument(std::string(motivo) + " en la posicion " + std::to_string(posicion) +
+                                    " (linea " + std::to_string(linea) + ")"),
+              posicion(posicion), linea(linea) {}
+    };
+
+    /**
+    * @brief Cuenta los separadores (`delimitador` y '\n') de un bloque con el kernel SIMD.
+    *
+    * Da una cota superior de la cantidad de campos, para reservar una sola vez.
+    */
+    inline size_t contarSeparadores(const char *texto, size_t n, char delimitador) {
+        size_t cuenta = 0;
+        size_t hecho = cppvector_simd::contar(texto, n, delimitador, cuenta);
+        for (size_t i = hecho; i < n; ++i) {
+            cuenta += texto[i] == delimitador;
+        }
+        if (delimitador != '\n') {
+            hecho = cppvector_simd::contar(texto, n, '\n', cuenta);
+            for (size_t i = hecho; i < n; ++i) {
+                cuenta += texto[i] == '\n';
+            }
+        }
+        return cuenta;
+    }
+
+    /**
+    * @brief Espacio que se ignora alrededor de un número; el delimitador nunca lo es (' ' o '\t' separan campos).
+    */
+    inline bool esEspacio(char c, char delimitador) noexcept {
+        return c != delimitador && (c == ' ' || c == '\t' || c == '\r');
+    }
+
+    /**
+    * @brief Lee los números de `texto` separados por `delimitador` o por saltos de línea.
+    *
+    * Se ignoran los espacios alrededor de cada número, las líneas vacías y un separador al
+    * final. Un campo vacío entre dos delimitadores es un error; si el delimitador es ' ' o
+    * '\t', ese caracter separa campos y deja de ignorarse como espacio.
+    *
+    * @param base Posición de `texto` dentro de la entrada completa (para los errores).
+    * @param linea Línea en la que empieza `texto`; se actualiza con los saltos leídos.
+    * @param agregar Invocable con (T) que recibe cada número.
+    * @throws ErrorAnalisis si un campo no es un número de tipo T o está fuera de rango.
+    */
+    template<typename T, typename Funcion>
+    void analizar(std::string_view texto, char delimitador, size_t base, size_t &linea, Funcion &&agregar) {
+        const char *p = texto.data();
+        const char *fin = p + texto.size();
+        auto error = [&](const char *motivo, const char *donde) {
+            return ErrorAnalisis(motivo, base + static_cast<size_t>(donde - texto.data()), linea);
+        };
+        while (true) {
+            while (p < fin && esEspacio(*p, delimitador)) ++p;
+            if (p == fin) return;
+            if (*p == '\n') {
+                ++linea;
+                ++p;
+                continue;
+            }
+            if (*p == delimitador) throw error("Campo vacio", p);
+            if (*p == '+' && p + 1 < fin && p[1] != '-') ++p;     // from_chars no acepta el signo +
+
+            T valor;
+            const auto [siguiente, codigo] = std::from_chars(p, fin, valor);
+            if (codigo == std::errc::result_out_of_range) throw error("Numero fuera de rango", p);
+            if (codigo != std::errc()) throw error("Numero invalido", p);
+            agregar(valor);
+
+            p = siguiente;
+            while (p < fin && esEspacio(*p, delimitador)) ++p;
+            if (p == fin) return;
+            if (*p == '\n') {
+                ++linea;
+            } else if (*p != delimitador) {
+                throw error("Caracter inesperado", p);
+            }
+            ++p;
+        }
+    }
+}
+
+/**
+* @brief Escritura de vectores numéricos como texto con std::to_chars (usado por Vector::formatearEn).
+*/
+namespace cppvector_formato {
+
+    /**
+    * @brief Delimitadores y formato numérico de la salida.
+    */
+    struct Formato {
+        std::string_view apertura = "[";
+        std::string_view separador = ", ";
+        std::string_view cierre = "]";
+        std::chars_format estilo = std::chars_format::general;  /// < Solo para punto flotante
+        int precision = -1;     /// < -1: la representacion mas corta que se vuelve a leer igual
+    };
+
+    /// Tipos que se escriben con std::to_chars (los de tipo caracter se escriben como numeros).
+    template<typename T>
+    inline constexpr bool formateable_v = std::is_arithmetic_v<T> && !std::is_same_v<T, bool>;
+
+    /// Tipos que un std::ostream escribe como numero (no como caracter).
+    template<typename T>
+    inline constexpr bool numerico_v = formateable_v<T> && !std::is_same_v<T, char> &&
+        !std::is_same_v<T, signed char> && !std::is_same_v<T, unsigned char> && !std::is_same_v<T, char8_t> &&
+        !std::is_same_v<T, char16_t> && !std::is_same_v<T, char32_t> && !std::is_same_v<T, wchar_t>;
+
+    /// < Tamaño del bloque de salida; la memoria usada no depende del tamaño del vector
+    inline constexpr size_t bytesBloque = size_t(1) << 14;
+
+    template<typename T>
+    std::to_chars_result convertir(char *primero, char *ultimo, T valor, const Formato &formato) {
+        if constexpr (std::is_floating_point_v<T>) {
+            if (formato.precision >= 0) return std::to_chars(primero, ultimo, valor, formato.estilo, formato.precision);
+            if (formato.estilo == std::chars_format::general) return std::to_chars(primero, ultimo, valor);
+            return std::to_chars(primero, ultimo, valor, formato.estilo);
+        } else if constexpr (std::is_signed_v<T>) {
+            return std::to_chars(primero, ultimo, static_cast<long long>(valor));
+        } else {
+            return std::to_chars(primero, ultimo, static_cast<unsigned long long>(valor));
+        }
+    }
+
+    /**
+    * @brief Convierte n elementos en un bloque de memoria y lo entrega a `escribir` cada vez que se llena.
+    *
+    * @param primero Iterador al primer elemento.
+    * @param escribir Invocable con (const char *, size_t) que recibe cada bloque de texto.
+    * @throws std::length_error si un solo número no cabe en un bloque (precisión absurda).
+    */
+    template<typename It, typename Escribir>
+    void escribirBloques(It primero, size_t n, const Formato &formato, Escribir &&escribir) {
+        char bloque[bytesBloque];
+        char *p = bloque;
+        char *const fin = bloque + bytesBloque;
+        auto vaciar = [&] {
+            if (p != bloque) escribir(static_cast<const char *>(bloque), static_cast<size_t>(p - bloque));
+            p = bloque;
+        };
+        auto agregarTexto = [&](std::string_view texto) {
+            if (texto.size() > static_cast<size_t>(fin - p)) {
+                vaciar();
+                if (texto.size() > bytesBloque) {
+                    escribir(texto.data(), texto.size());
+                    return;
+                }
+            }
+            std::memcpy(p, texto.data(), texto.size());
+            p += texto.size();
+        };
+
+        agregarTexto(formato.apertura);
+        for (size_t i = 0; i < n; ++i, ++primero) {
+            if (i > 0) agregarTexto(formato.separador);
+            auto resultado = convertir(p, fin, *primero, formato);
+            if (resultado.ec != std::errc()) {
+                vaciar();
+                resultado = convertir(p, fin, *primero, formato);
+                if (resultado.ec != std::errc()) throw std::length_error("Numero demasiado largo para el bloque de salida");
+            }
+            p = resultado.ptr;
+        }
+        agregarTexto(formato.cierre);
+        vaciar();
+    }
+
+    /**
+    * @brief Formato equivalente al estado del flujo, si to_chars puede reproducirlo exactamente.
+    *
+    * Reproduce la base decimal y fixed/scientific/general con la precisión del flujo. Si hay
+    * ancho, otra base, signo +, mayúsculas, showpoint o un locale distinto del clásico
+    * (separadores de miles, coma decimal), devuelve false y se usa operator<<.
+    */
+    inline bool formatoDeFlujo(const std::ostream &os, Formato &formato) {
+        if (os.getloc() != std::locale::classic()) return false;
+        const std::ios_base::fmtflags admitidas = std::ios_base::dec | std::ios_base::skipws | std::ios_base::fixed |
+            std::ios_base::scientific | std::ios_base::boolalpha | std::ios_base::unitbuf | std::ios_base::adjustfield;
+        if (os.width() != 0 || (os.flags() & ~admitidas) != 0) return false;
+        const std::ios_base::fmtflags flotante = os.flags() & std::ios_base::floatfield;
+        if (flotante == std::ios_base::floatfield) return false;     // hexfloat
+        formato.estilo = flotante == std::ios_base::fixed ? std::chars_format::fixed
+                       : flotante == std::ios_base::scientific ? std::chars_format::scientific
+                       : std::chars_format::general;
+        formato.precision = static_cast<int>(os.precision());
+        if (formato.estilo == std::chars_format::general && formato.precision == 0) formato.precision = 1;
+        return true;
+    }
+
+    /**
+    * @brief Escribe n elementos en un flujo con los delimitadores dados.
+    *
+    * Los tipos numéricos se convierten por bloques con to_chars y se escriben con una llamada
+    * a write por bloque; el resto (o un flujo con formato especial) usa operator<< por elemento.
+    */
+    template<typename T, typename It>
+    void escribirFlujo(std::ostream &os, It primero, size_t n, std::string_view apertura,
+                       std::string_view separador, std::string_view cierre) {
+        if constexpr (numerico_v<T>) {
+            Formato formato{apertura, separador, cierre};
+            if (formatoDeFlujo(os, formato)) {
+                escribirBloques(primero, n, formato, [&](const char *texto, size_t bytes) {
+                    os.write(texto, static_cast<std::streamsize>(bytes));
+                });
+                return;
+            }
+        }
+        os << apertura;
+        for (size_t i = 0; i < n; ++i, ++primero) {
+            if (i > 0) os << separador;
+            os << *primero;
+        }
+        os << cierre;
+    }
+}
+
+// Inicio vista de vector
+
+/**
+* @struct VectorView
+* @brief Vista de solo lectura sobre un bloque contiguo de elementos (puntero + tamaño + paso).
+*
+* No reserva memoria ni copia elementos: crear una vista o una subvista es O(1). Ofrece la
+* API de consulta de Vector (`contiene`, `buscar`, `contar`, `estaOrdenado`...) y, si el
+* vector de origen estaba ordenado, las búsquedas usan búsqueda binaria.
+*
+* @warning La vista no es dueña de los datos: deja de ser válida si el vector de origen
+*          se destruye o realoca.
+*
+* @tparam tipodato Tipo de dato observado
+*/
+template<typename tipodato>
+struct VectorView {
+private:
+    const tipodato *datos_;     /// < Primer elemento observado
+    size_t tamano_;             /// < Cantidad de elementos visibles
+    size_t paso_;               /// < Distancia (en elementos) entre dos elementos visibles
+    bool ordenado_;             /// < true si los elementos visibles están en orden ascendente
+
+public:
+    using value_type = tipodato;
+    using const_reference = const tipodato&;
+    using const_pointer = const tipodato*;
+
+    constexpr VectorView() noexcept : datos_(nullptr), tamano_(0), paso_(1), ordenado_(true) {}
+
+    /**
+     * @brief Construye una vista sobre un bloque de memoria.
+     * @param datos Puntero al primer elemento.
+     * @param tamano Cantidad de elementos visibles.
+     * @param ordenado Indica si los elementos están en orden ascendente.
+     * @param paso Distancia entre elementos consecutivos de la vista (1 = contiguo).
+     */
+    constexpr VectorView(const tipodato *datos, size_t tamano, bool ordenado = false, size_t paso = 1) noexcept
+        : datos_(datos), tamano_(tamano), paso_(paso == 0 ? 1 : paso), ordenado_(ordenado || tamano <= 1) {}
+
+    /**
+     * @struct ConstIterator
+     * @brief Iterador constante de acceso aleatorio que respeta el paso de la vista.
+     *
+     * Guarda el inicio de la vista y un índice: con paso > 1, `end()` no puede representarse
+     * como puntero sin salir del bloque observado.
+     */
+    struct ConstIterator {
+        const tipodato *base;   /// < Primer elemento de la vista
+        std::ptrdiff_t indice;  /// < Posición actual dentro de la vista
+        size_t paso;            /// < Distancia entre elementos
+
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = tipodato;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const tipodato*;
+        using reference = const tipodato&;
+
+        constexpr ConstIterator() noexcept : base(nullptr), indice(0), paso(1) {}
+        constexpr ConstIterator(const tipodato *b, std::ptrdiff_t i, size_t s) noexcept : base(b), indice(i), paso(s) {}
+
+        constexpr const tipodato &operator*() const noexcept { return base[indice * static_cast<std::ptrdiff_t>(paso)]; }
+        constexpr const tipodato *operator->() const noexcept { return base + indice * static_cast<std::ptrdiff_t>(paso); }
+        constexpr const tipodato &operator[](std::ptrdiff_t n) const noexcept { return base[(indice + n) * static_cast<std::ptrdiff_t>(paso)]; }
+
+        constexpr ConstIterator &operator++() noexcept { ++indice; return *this; }
+        constexpr ConstIterator operator++(int) noexcept { ConstIterator aux = *this; ++indice; return aux; }
+        constexpr ConstIterator &operator--() noexcept { --indice; return *this; }
+        constexpr ConstIterator operator--(int) noexcept { ConstIterator aux = *this; --indice; return aux; }
+
+        constexpr ConstIterator &operator+=(std::ptrdiff_t n) noexcept { indice += n; return *this; }
+        constexpr ConstIterator &operator-=(std::ptrdiff_t n) noexcept { indice -= n; return *this; }
+        constexpr ConstIterator operator+(std::ptrdiff_t n) const noexcept { return ConstIterator(base, indice + n, paso); }
+        constexpr ConstIterator operator-(std::ptrdiff_t n) const noexcept { return ConstIterator(base, indice - n, paso); }
+        constexpr difference_type operator-(const ConstIterator &o) const noexcept { return indice - o.indice; }
+        friend constexpr ConstIterator operator+(std::ptrdiff_t n, const ConstIterator &it) noexcept { return it + n; }
+
+        constexpr bool operator==(const ConstIterator &o) const noexcept { return indice == o.indice; }
+        constexpr bool operator!=(const ConstIterator &o) const noexcept { return indice != o.indice; }
+        constexpr bool operator<(const ConstIterator &o) const noexcept { return indice < o.indice; }
+        constexpr bool operator>(const ConstIterator &o) const noexcept { return indice > o.indice; }
+        constexpr bool operator<=(const ConstIterator &o) const noexcept { return indice <= o.indice; }
+        constexpr bool operator>=(const ConstIterator &o) const noexcept { return indice >= o.indice; }
+    };
+
+    static_assert(std::random_access_iterator<ConstIterator>);
+
+    constexpr ConstIterator begin() const noexcept { return ConstIterator(datos_, 0, paso_); }
+    constexpr ConstIterator end() const noexcept { return ConstIterator(datos_, static_cast<std::ptrdiff_t>(tamano_), paso_); }
+    constexpr ConstIterator cbegin() const noexcept { return begin(); }
+    constexpr ConstIterator cend() const noexcept { return end(); }
+
+    /**
+    * @brief Accede a un valor por índice (no verificado).
+    * @param indice Índice del valor.
+    * @return Referencia constante al valor.
+    */
+    constexpr const tipodato &operator[](size_t indice) const noexcept {
+        return datos_[indice * paso_];
+    }
+
+    /**
+     * @brief Devuelve el valor ubicado en un índice específico.
+     * @param indice Índice del valor.
+     * @return Referencia constante al valor.
+     * @throws std::out_of_range si el índice es inválido.
+     */
+    constexpr const tipodato &en(size_t indice) const {
+        if (indice >= tamano_) {
+            throw std::out_of_range("Indice fuera de rango");
+        }
+        return datos_[indice * paso_];
+    }
+
+    /**
+    * @brief Devuelve el primer elemento de la vista.
+    * @throws std::out_of_range Si la vista está vacía.
+    */
+    constexpr const tipodato &frente() const {
+        if (tamano_ == 0) throw std::out_of_range("No hay elementos en la vista");
+        return datos_[0];
+    }
+
+    /**
+    * @brief Devuelve el último elemento de la vista.
+    * @throws std::out_of_range Si la vista está vacía.
+    */
+    constexpr const tipodato &atras() const {
+        if (tamano_ == 0) throw std::out_of_range("No hay elementos en la vista");
+        return datos_[(tamano_ - 1) * paso_];
+    }
+
+    /**
+     * @brief Verifica si los elementos visibles están ordenados.
+     * @return true si se sabe que están en orden ascendente.
+     */
+    [[nodiscard]] constexpr bool estaOrdenado() const noexcept {
+        return ordenado_;
+    }
+
+    [[nodiscard]] constexpr bool vacio() const noexcept {
+        return tamano_ == 0;
+    }
+
+    [[nodiscard]] constexpr size_t obtenerTamano() const noexcept {
+        return tamano_;
+    }
+
+    /**
+    * @brief Devuelve la distancia entre elementos consecutivos de la vista.
+    */
+    [[nodiscard]] constexpr size_t obtenerPaso() const noexcept {
+        return paso_;
+    }
+
+    /**
+    * @brief Devuelve el puntero al primer elemento (contiguo solo si el paso es 1).
+    */
+    constexpr const tipodato *data() const noexcept {
+        return datos_;
+    }
+
+    /**
+    * @brief Verifica si la vista contiene un valor.
+    *
+    * Usa búsqueda binaria si la vista está ordenada.
+    *
+    * @param dato Valor a buscar.
+    * @return true si se encuentra el valor.
+    */
+    constexpr bool contiene(const tipodato &dato) const {
+        return buscar(dato) != -1;
+    }
+
+    /**
+    * @brief Busca un valor en la vista.
+    *
+    * Usa búsqueda binaria si la vista está ordenada (devuelve la primera aparición).
+    *
+    * @param dato Valor a buscar.
+    * @return Índice del valor si se encuentra, -1 en caso contrario.
+    */
+    constexpr int buscar(const tipodato &dato) const {
+        if constexpr (requires (const tipodato &a, const tipodato &b) { a < b; }) {
+            if (ordenado_) {
+                const ConstIterator it = std::lower_bound(begin(), end(), dato);
+                return it != end() && *it == dato ? static_cast<int>(it - begin()) : -1;
+            }
+        }
+        for (size_t i = 0; i < tamano_; i++) {
+            if (datos_[i * paso_] == dato) {
+                return static_cast<int>(i);
+            }
+        }
+        return -1;
+    }
+
+    /**
+    * @brief Cuenta cuántas veces aparece un dato en la vista.
+    *
+    * Usa std::equal_range si la vista está ordenada.
+    *
+    * @param dato Valor a contar.
+    * @return Número de apariciones del valor.
+    */
+    constexpr size_t contar(const tipodato &dato) const {
+        if constexpr (requires (const tipodato &a, const tipodato &b) { a < b; }) {
+            if (ordenado_) {
+                const auto rango = std::equal_range(begin(), end(), dato);
+                return static_cast<size_t>(rango.second - rango.first);
+            }
+        }
+        size_t contador = 0;
+        for (size_t i = 0; i < tamano_; i++) {
+            if (datos_[i * paso_] == dato) {
+                ++contador;
+            }
+        }
+        return contador;
+    }
+
+    /**
+    * @brief Crea una subvista del rango [desde, hasta) en O(1).
+    * @param desde Índice de inicio (inclusive).
+    * @param hasta Índice de fin (exclusive).
+    * @return Subvista (vacía si los índices no son válidos).
+    */
+    constexpr VectorView subvista(size_t desde, size_t hasta) const noexcept {
+        if (desde >= hasta || hasta > tamano_) {
+            return VectorView{};
+        }
+        return VectorView(datos_ + desde * paso_, hasta - desde, ordenado_, paso_);
+    }
+
+    /**
+    * @brief Crea una vista que toma uno de cada `n` elementos en O(1).
+    * @param n Paso relativo a esta vista (0 se trata como 1).
+    * @return Vista con paso multiplicado por n.
+    */
+    constexpr VectorView conPaso(size_t n) const noexcept {
+        if (n <= 1 || tamano_ == 0) {
+            return *this;
+        }
+        return VectorView(datos_, (tamano_ + n - 1) / n, ordenado_, paso_ * n);
+    }
+
+    /**
+    * @brief Operador de salida.
+    * @param os Flujo de salida.
+    * @param v Vista a imprimir.
+    * @return Referencia al flujo de salida.
+    */
+    friend std::ostream &operator<<(std::ostream &os, const VectorView &v) {
+        cppvector_formato::escribirFlujo<tipodato>(os, v.begin(), v.tamano_, "[", ", ", "]");
+        return os;
+    }
+
+    /** @name Métodos en inglés
+    *Métodos alternativos con nombres en inglés.
+    */
+    ///@{
+    constexpr const tipodato &at(size_t index) const { return en(index); }
+    constexpr const tipodato &front() const { return frente(); }
+    constexpr const tipodato &back() const { return atras(); }
+    [[nodiscard]] constexpr bool isSorted() const noexcept { return estaOrdenado(); }
+    [[nodiscard]] constexpr bool empty() const noexcept { return vacio(); }
+    [[nodiscard]] constexpr size_t size() const noexcept { return obtenerTamano(); }
+    [[nodiscard]] constexpr size_t stride() const noexcept { return obtenerPaso(); }
+    constexpr bool contains(const tipodato &value) const { return contiene(value); }
+    constexpr int find(const tipodato &value) const { return buscar(value); }
+    constexpr size_t count(const tipodato &value) const { return contar(value); }
+    constexpr VectorView subview(size_t from, size_t to) const noexcept { return subvista(from, to); }
+    constexpr VectorView strided(size_t n) const noexcept { return conPaso(n); }
+    ///@}
+};
+
+/**
+* @brief Acceso de la serialización binaria (serialization.h) al estado interno de Vector.
+*/
+namespace cppvector_serial {
+    struct AccesoVector;
 }
 
 // Inicio vector dinamico
@@ -76,12 +853,12 @@ template<typename tipodato, typename Allocator = std::allocator<tipodato> >
 struct Vector {
 
     template<typename Alloc, typename Ptr, typename... Args>
-    void alloc_construct(Alloc& alloc, Ptr ptr, Args&&... args) {
+    constexpr void alloc_construct(Alloc& alloc, Ptr ptr, Args&&... args) {
         std::allocator_traits<Alloc>::construct(alloc, ptr, std::forward<Args>(args)...);
     }
 
     template<typename Alloc, typename Ptr>
-    void alloc_destroy(Alloc& alloc, Ptr ptr) {
+    constexpr void alloc_destroy(Alloc& alloc, Ptr ptr) {
         std::allocator_traits<Alloc>::destroy(alloc, ptr);
     }
 
@@ -93,6 +870,29 @@ private:
 
     bool ordenado_;     /// < Bool para evitar doble ordenamiento
 
+    /// < Indica si tipodato admite operator< para mantener ordenado_
+    static constexpr bool comparable_ = requires (const tipodato &a, const tipodato &b) { a < b; };
+
+    friend struct cppvector_serial::AccesoVector;
+
+    /**
+    * @brief Mueve n elementos con memmove si el tipo es trivialmente copiable.
+    *
+    * Durante la evaluación constante (constexpr) memmove no está disponible: devuelve false
+    * y el llamador mueve elemento a elemento, igual que para los tipos no triviales.
+    *
+    * @return true si los elementos se movieron.
+    */
+    static constexpr bool moverMemoria(tipodato *destino, const tipodato *origen, size_t n) noexcept {
+        if constexpr (std::is_trivially_copyable_v<tipodato>) {
+            if (!std::is_constant_evaluated()) {
+                std::memmove(destino, origen, n * sizeof(tipodato));
+                return true;
+            }
+        }
+        return false;
+    }
+
 public:
     using value_type = tipodato;
     using reference = tipodato&;
@@ -102,13 +902,13 @@ public:
     using iterator = tipodato*;
     using const_iterator = const tipodato*;
 
-    Vector() : datos_(nullptr), tamano_(0), capacidad_(0), ordenado_(true) {}
+    constexpr Vector() : datos_(nullptr), tamano_(0), capacidad_(0), ordenado_(true) {}
 
     /**
      * @brief Constructor para la initializer list
      *  @param lista
      **/
-    Vector(std::initializer_list<tipodato> lista) : ordenado_(lista.size() <= 1) {
+    constexpr Vector(std::initializer_list<tipodato> lista) : ordenado_(lista.size() <= 1) {
         tamano_ = capacidad_ = lista.size();
         datos_ = alloc.allocate(capacidad_);
         size_t i = 0;
@@ -123,19 +923,41 @@ public:
      * @param Capacidad
      * @param valor
      */
-    explicit Vector(size_t Capacidad, const tipodato &valor = tipodato()) : ordenado_(true) {
+    constexpr explicit Vector(size_t Capacidad, const tipodato &valor = tipodato()) : ordenado_(true) {
         datos_ = alloc.allocate(Capacidad);
         tamano_ = Capacidad;
         capacidad_ = Capacidad;
-        for (size_t i = 0; i < Capacidad; i++) {
-            alloc_construct(alloc, &datos_[i], valor);
+        llenar(datos_, Capacidad, valor);
+    }
+
+    /**
+     * @brief Constructor que copia los elementos de una vista.
+     *
+     * Reserva una sola vez y hereda el estado de orden de la vista.
+     *
+     * @param vista
+     */
+    constexpr explicit Vector(const VectorView<tipodato> &vista) : ordenado_(vista.estaOrdenado()) {
+        tamano_ = capacidad_ = vista.obtenerTamano();
+        datos_ = capacidad_ ? alloc.allocate(capacidad_) : nullptr;
+        size_t i = 0;
+        try {
+            for (; i < tamano_; ++i) {
+                alloc_construct(alloc, &datos_[i], vista[i]);
+            }
+        } catch (...) {
+            for (size_t j = 0; j < i; ++j) {
+                alloc_destroy(alloc, &datos_[j]);
+            }
+            alloc.deallocate(datos_, capacidad_);
+            throw;
         }
     }
 
     /**
      * @brief Destructor de la clase Vector
      */
-    ~Vector() {
+    constexpr ~Vector() {
         assert(tamano_ <= capacidad_);
         for (size_t i = 0; i < tamano_; ++i) {
             alloc_destroy(alloc, &datos_[i]);
@@ -149,7 +971,7 @@ public:
      * @brief Constructor para move semantics, admite otro vector como parametro
      * @param otro
      */
-    Vector(Vector &&otro) noexcept {
+    constexpr Vector(Vector &&otro) noexcept {
         datos_ = otro.datos_;
         tamano_ = otro.tamano_;
         capacidad_ = otro.capacidad_;
@@ -165,7 +987,7 @@ public:
      * @param otro
      * @return
      */
-    Vector &operator=(Vector &&otro) noexcept {
+    constexpr Vector &operator=(Vector &&otro) noexcept {
         if (this!=&otro) {
             for (size_t i = 0; i < tamano_; ++i) {
                 alloc_destroy(alloc,&datos_[i]);
@@ -190,7 +1012,7 @@ public:
      * @param otro
      * @return
      */
-    Vector& operator=(const Vector& otro) {
+    constexpr Vector& operator=(const Vector& otro) {
         if (this != &otro) {
             Vector temp(otro);
             swap(temp);
@@ -202,11 +1024,19 @@ public:
      * Constructor que permite la inclusion de otro vector como inicializador
      * @param otro
      */
-    Vector(const Vector& otro) {
+    constexpr Vector(const Vector& otro) {
         datos_ = alloc.allocate(otro.capacidad_);
         tamano_ = otro.tamano_;
         capacidad_ = otro.capacidad_;
         ordenado_ = otro.ordenado_;
+        if (construccionParalela(tamano_)) {
+            cppvector_paralelo::paraPaginas(datos_, tamano_, [&](size_t desde, size_t hasta) {
+                for (size_t i = desde; i < hasta; ++i) {
+                    alloc_construct(alloc, &datos_[i], otro.datos_[i]);
+                }
+            });
+            return;
+        }
         for (size_t i = 0; i < tamano_; ++i) {
             alloc_construct(alloc, &datos_[i], otro.datos_[i]);
         }
@@ -770,14 +1600,14 @@ public:
      * @brief Devuelve un iterador constante al inicio de la colección.
      * @return ConstIterator apuntando al primer elemento.
      */
-    ConstIterator cbegin() const {
+    constexpr ConstIterator cbegin() const {
         return ConstIterator(datos_);
     }
     /**
      * @brief Devuelve un iterador constante al final de la colección.
      * @return ConstIterator apuntando justo después del último elemento.
      */
-    ConstIterator cend() const {
+    constexpr ConstIterator cend() const {
         return ConstIterator(datos_+tamano_);
     }
 
@@ -941,14 +1771,14 @@ public:
      * @brief Devuelve un iterador constante reverso al final de la colección.
      * @return ConstReverseIterator apuntando al último elemento.
      */
-    ConstReverseIterator crbegin() const {
+    constexpr ConstReverseIterator crbegin() const {
         return ConstReverseIterator(datos_+tamano_-1);
     }
     /**
      * @brief Devuelve un iterador constante reverso al inicio de la colección.
      * @return ConstReverseIterator apuntando justo antes del primer elemento.
      */
-    ConstReverseIterator crend() const {
+    constexpr ConstReverseIterator crend() const {
         return ConstReverseIterator(datos_-1);
     }
 
@@ -977,19 +1807,16 @@ public:
     /**
     * @brief Operador de salida.
     *
-    * Permite imprimir el contenido del vector usando std::ostream.
+    * Permite imprimir el contenido del vector usando std::ostream. Los tipos numéricos se
+    * convierten por bloques con std::to_chars (un write por bloque) si el formato del flujo
+    * lo permite; si no, se escribe elemento a elemento.
     *
     * @param os Flujo de salida.
     * @param v Vector a imprimir.
     * @return Referencia al flujo de salida.
     */
     friend std::ostream &operator<<(std::ostream &os, const Vector &v) {
-        os << "[";
-        for (size_t i = 0; i < v.tamano_; i++) {
-            if (i > 0) os << ", ";
-            os << v.datos_[i];
-        }
-        os << "]";
+        cppvector_formato::escribirFlujo<tipodato>(os, v.datos_, v.tamano_, "[", ", ", "]");
         return os;
     }
 
@@ -1001,7 +1828,7 @@ public:
      * @param otro Vector a comparar.
      * @return true si son iguales, false en caso contrario.
      */
-    bool operator==(const Vector &otro) const {
+    constexpr bool operator==(const Vector &otro) const {
         if (tamano_ != otro.tamano_) return false;
         for (size_t i = 0; i < tamano_; i++) {
             if (!areEqual(datos_[i], otro.datos_[i])) {
@@ -1017,7 +1844,7 @@ public:
      * @param otro Vector a comparar.
      * @return true si son diferentes, false si son iguales.
      */
-    bool operator!=(const Vector &otro) const {
+    constexpr bool operator!=(const Vector &otro) const {
         if (tamano_ != otro.tamano_) return true;
         for (size_t i = 0; i < tamano_; i++) {
             if (datos_[i] != otro.datos_[i]) return true;
@@ -1025,22 +1852,22 @@ public:
         return false;
     }
 
-    bool operator<(const Vector& otro) const {
+    constexpr bool operator<(const Vector& otro) const {
         return std::lexicographical_compare(
             datos_, datos_ + tamano_,
             otro.datos_, otro.datos_ + otro.tamano_
         );
     }
 
-    bool operator<=(const Vector& otro) const {
+    constexpr bool operator<=(const Vector& otro) const {
         return *this < otro || *this == otro;
     }
 
-    bool operator>(const Vector& otro) const {
+    constexpr bool operator>(const Vector& otro) const {
         return !(*this <= otro);
     }
 
-    bool operator>=(const Vector& otro) const {
+    constexpr bool operator>=(const Vector& otro) const {
         return !(*this < otro);
     }
 
@@ -1054,7 +1881,7 @@ public:
      * @param args Argumentos para el constructor de tipodato.
      */
     template<typename... Args>
-    void emplace(size_t indice, Args&&... args) {
+    constexpr void emplace(size_t indice, Args&&... args) {
         if (indice > tamano_) {
             throw std::out_of_range("Indice fuera de rango");
         }
@@ -1083,7 +1910,7 @@ public:
      * @param args Argumentos para el constructor de tipodato.
      */
     template <typename... Args>
-    void emplace_back(Args&&... args) {
+    constexpr void emplace_back(Args&&... args) {
         if (tamano_ == capacidad_) {
             cambiarCapacidad(capacidad_ == 0 ? 1 : capacidad_ * 2);
         }
@@ -1101,7 +1928,7 @@ public:
      * @param nuevoTam Nuevo tamaño.
      * @param dato Valor con el que se rellenan los nuevos elementos (por defecto tipodato()).
      */
-    void redimensionar(size_t nuevoTam, const tipodato &dato = tipodato()) {
+    constexpr void redimensionar(size_t nuevoTam, const tipodato &dato = tipodato()) {
         if (nuevoTam < tamano_) {
             for (size_t i = nuevoTam; i < tamano_; ++i) {
                 alloc_destroy(alloc, &datos_[i]);
@@ -1121,13 +1948,15 @@ public:
             }
 
             bool mantiene_orden = true;
-            if (ordenado_ && tamano_ > 0) {
-                mantiene_orden = !(dato < datos_[tamano_ - 1]);
+            if constexpr (comparable_) {
+                if (ordenado_ && tamano_ > 0) {
+                    mantiene_orden = !(dato < datos_[tamano_ - 1]);
+                }
+            } else {
+                mantiene_orden = tamano_ == 0 && nuevoTam == 1;
             }
 
-            for (size_t i = tamano_; i < nuevoTam; i++) {
-                alloc_construct(alloc, &datos_[i], dato);
-            }
+            llenar(datos_ + tamano_, nuevoTam - tamano_, dato);
             tamano_ = nuevoTam;
 
             if (tamano_ == 1) {
@@ -1143,7 +1972,7 @@ public:
      *
      * Reinicia tamaño y capacidad a cero.
      */
-    void clear() {
+    constexpr void clear() {
         vaciar();
     }
 
@@ -1156,7 +1985,7 @@ public:
     *
     * @param new_size La capacidad mínima requerida.
     */
-    void aumentarCapacidad(const size_t new_size) {
+    constexpr void aumentarCapacidad(const size_t new_size) {
         if (new_size <= capacidad_) return;
         const size_t new_cap = std::max(new_size, capacidad_ * 2);
         tipodato* new_data = alloc.allocate(new_cap);
@@ -1184,7 +2013,7 @@ public:
     * @param range El rango de elementos a añadir.
     */
     template <std::ranges::input_range R>
-    void agregarRango(R&& range) {
+    constexpr void agregarRango(R&& range) {
         if constexpr (std::ranges::sized_range<R>) {
             auto count = std::ranges::distance(range);
             aumentarCapacidad(tamano_ + count);
@@ -1211,7 +2040,7 @@ public:
     * @throws std::out_of_range si pos > tamaño actual.
     */
     template <std::ranges::input_range R>
-    Iterator insertarRango(size_t pos, R&& range) {
+    constexpr Iterator insertarRango(size_t pos, R&& range) {
         static_assert(std::convertible_to<std::ranges::range_reference_t<R>, tipodato>,
                       "El tipo de elemento debe ser convertible a tipodato");
 
@@ -1279,8 +2108,12 @@ public:
      *
      * @param dato Valor a agregar.
      */
-    void agregarFinal(tipodato&& dato) {
-        if (ordenado_ && !empty() && dato < datos_[tamano_ - 1]) {
+    constexpr void agregarFinal(tipodato&& dato) {
+        if constexpr (comparable_) {
+            if (ordenado_ && !empty() && dato < datos_[tamano_ - 1]) {
+                ordenado_ = false;
+            }
+        } else {
             ordenado_ = false;
         }
         if (tamano_ == capacidad_)
@@ -1294,7 +2127,7 @@ public:
     *
     * @param dato Valor a agregar.
     */
-    void agregarFinal(const tipodato& dato) {
+    constexpr void agregarFinal(const tipodato& dato) {
         if constexpr (requires { dato < datos_[tamano_ - 1]; }) {
             if (ordenado_ && !empty() && dato < datos_[tamano_ - 1]) {
                 ordenado_ = false;
@@ -1306,13 +2139,80 @@ public:
         ++tamano_;
     }
 
+    /**
+     * @brief Agrega n elementos sin inicializar y devuelve un puntero al primero.
+     *
+     * Si no alcanza la capacidad, al menos la duplica (llamadas repetidas no son cuadráticas) y
+     * no escribe nada en la memoria nueva, para que el llamador la llene directamente (por
+     * ejemplo, con memcpy en paralelo). Solo para tipos triviales.
+     *
+     * @param n Cantidad de elementos a agregar.
+     * @return Puntero al primer elemento nuevo.
+     */
+    constexpr tipodato* agregarSinInicializar(size_t n)
+        requires std::is_trivially_copyable_v<tipodato> && std::is_trivially_default_constructible_v<tipodato> {
+        if (tamano_ + n > capacidad_) {
+            cambiarCapacidad(std::max(tamano_ + n, capacidad_ * 2));
+        }
+        tipodato* primero = datos_ + tamano_;
+        if (std::is_constant_evaluated()) {
+            // En evaluación constante no se puede leer memoria sin inicializar
+            for (size_t i = 0; i < n; ++i) {
+                alloc_construct(alloc, &primero[i]);
+            }
+        }
+        tamano_ += n;
+        if (n > 0 && tamano_ > 1) {
+            ordenado_ = false;
+        }
+        return primero;
+    }
+
+    /**
+     * @brief Agrega al final los elementos de un rango de entrada, en lotes.
+     *
+     * Pensado para fuentes que no conocen su tamaño, como un generador de corrutinas: reserva
+     * espacio para `lote` elementos, los construye directamente en la cola y revisa el orden
+     * una vez por lote, en lugar de comprobar la capacidad y el orden en cada agregarFinal.
+     * Si la fuente lanza una excepción, los elementos ya obtenidos quedan agregados.
+     *
+     * @tparam R Tipo que satisface std::ranges::input_range.
+     * @param fuente Rango de elementos a agregar (se recorre una sola vez).
+     * @param lote Cantidad de elementos reservados por vez.
+     * @return Cantidad de elementos agregados.
+     */
+    template <std::ranges::input_range R>
+    constexpr size_t agregarDesde(R&& fuente, size_t lote = 1024) {
+        if (lote == 0) lote = 1;
+        auto it = std::ranges::begin(fuente);
+        const auto fin = std::ranges::end(fuente);
+        const size_t inicial = tamano_;
+        while (it != fin) {
+            if (tamano_ + lote > capacidad_) {
+                cambiarCapacidad(std::max(tamano_ + lote, capacidad_ * 2));
+            }
+            const size_t desde = tamano_;
+            try {
+                for (size_t i = 0; i < lote && it != fin; ++i, ++it) {
+                    alloc_construct(alloc, &datos_[tamano_], *it);
+                    ++tamano_;
+                }
+            } catch (...) {
+                verificarOrdenLote(desde);
+                throw;
+            }
+            verificarOrdenLote(desde);
+        }
+        return tamano_ - inicial;
+    }
+
     /**
      * @brief Obtiene el último elemento del vector.
      *
      * @return Referencia al último elemento.
      * @throws std::out_of_range si el vector está vacío.
      */
-    tipodato &ultimo() {
+    constexpr tipodato &ultimo() {
         if (tamano_==0) throw std::out_of_range("No hay elementos en el vector");
         return datos_[tamano_ - 1];
     }
@@ -1323,7 +2223,7 @@ public:
      * @param indice Índice del valor.
      * @return Referencia al valor.
      */
-    tipodato &operator[](size_t indice) {
+    constexpr tipodato &operator[](size_t indice) {
         return datos_[indice];
     }
 
@@ -1333,7 +2233,7 @@ public:
     * @param indice Índice del valor.
     * @return Referencia constante al valor.
     */
-    const tipodato &operator[](size_t indice) const {
+    constexpr const tipodato &operator[](size_t indice) const {
         return datos_[indice];
     }
 
@@ -1346,7 +2246,7 @@ public:
      * @return Referencia al valor.
      * @throws std::out_of_range si el índice es inválido.
      */
-    tipodato &en(size_t indice) {
+    constexpr tipodato &en(size_t indice) {
         if (indice>=tamano_) {
             throw std::out_of_range("Indice fuera de rango");
         }
@@ -1362,7 +2262,7 @@ public:
      * @return Referencia al valor.
      * @throws std::out_of_range si el índice es inválido.
      */
-    const tipodato &en(size_t indice) const {
+    constexpr const tipodato &en(size_t indice) const {
         if (indice>=tamano_) {
             throw std::out_of_range("Indice fuera de rango");
         }
@@ -1377,7 +2277,7 @@ public:
      * @return Referencia al valor.
      * @throws std::out_of_range si el índice es inválido.
      */
-    tipodato &at(size_t indice) {
+    constexpr tipodato &at(size_t indice) {
         if (indice>=tamano_) {
             throw std::out_of_range("Indice fuera de rango");
         }
@@ -1392,7 +2292,7 @@ public:
      * @return Referencia al valor.
      * @throws std::out_of_range si el índice es inválido.
      */
-    const tipodato &at(size_t indice) const {
+    constexpr const tipodato &at(size_t indice) const {
         if (indice>=tamano_) {
             throw std::out_of_range("Indice fuera de rango");
         }
@@ -1403,16 +2303,30 @@ public:
      * @brief Verifica si el vector está ordenado.
      * @return true si el vector está ordenado.
      */
-    [[nodiscard]] bool estaOrdenado() const {
+    [[nodiscard]] constexpr bool estaOrdenado() const {
         return ordenado_;
     }
 
+    /**
+     * @brief Recalcula si el vector está ordenado recorriéndolo una vez.
+     *
+     * Para usar tras escribir los elementos directamente (por `data()` o después de
+     * `agregarSinInicializar`), ya que esas escrituras no actualizan el estado de orden.
+     */
+    constexpr void revisarOrden() {
+        if constexpr (comparable_) {
+            verificarOrden();
+        } else {
+            ordenado_ = tamano_ <= 1;
+        }
+    }
+
     /**
      * @brief Verifica si el vector está vacío.
      *
      * @return true si el tamaño es 0, false en caso contrario.
      */
-    [[nodiscard]] bool vacio() const {
+    [[nodiscard]] constexpr bool vacio() const {
         return tamano_ == 0;
     }
 
@@ -1421,7 +2335,7 @@ public:
     *
     * @return Tamaño del vector.
     */
-    [[nodiscard]] size_t obtenerTamano() const {
+    [[nodiscard]] constexpr size_t obtenerTamano() const {
         return tamano_;
     }
 
@@ -1430,14 +2344,14 @@ public:
      *
      * @return Capacidad del vector.
      */
-    [[nodiscard]] size_t obtenerCapacidad() const {
+    [[nodiscard]] constexpr size_t obtenerCapacidad() const {
         return capacidad_;
     }
     /**
     * @brief Devuelve la capacidad restante disponible en el vector.
     * @return Número de elementos que se pueden insertar antes de redimensionar.
     */
-    [[nodiscard]] size_t capacidadLibre() const {
+    [[nodiscard]] constexpr size_t capacidadLibre() const {
         return capacidad_ - tamano_;
     }
 
@@ -1449,7 +2363,7 @@ private:
     *
     * @param nuevaCapacidad Nueva capacidad deseada.
     */
-    void cambiarCapacidad(size_t nuevaCapacidad = 0) {
+    constexpr void cambiarCapacidad(size_t nuevaCapacidad = 0) {
         if (nuevaCapacidad == 0) {
             nuevaCapacidad = capacidad_ == 0 ? 1 : capacidad_ * 2;
         }
@@ -1461,7 +2375,14 @@ private:
         tipodato* nuevo = alloc.allocate(nuevaCapacidad);
 
         try {
-            std::uninitialized_move(datos_, datos_ + tamano_, nuevo);
+            if (std::is_constant_evaluated()) {
+                // std::uninitialized_move no es constexpr en C++20
+                for (size_t i = 0; i < tamano_; ++i) {
+                    alloc_construct(alloc, &nuevo[i], std::move(datos_[i]));
+                }
+            } else {
+                std::uninitialized_move(datos_, datos_ + tamano_, nuevo);
+            }
         } catch (...) {
             alloc.deallocate(nuevo, nuevaCapacidad);
             throw;
@@ -1475,23 +2396,184 @@ private:
             alloc.deallocate(datos_, capacidad_);
         }
 
-        datos_ = nuevo;
-        capacidad_ = nuevaCapacidad;
+        datos_ = nuevo;
+        capacidad_ = nuevaCapacidad;
+    }
+
+    /**
+    * @brief Invierte el rango [desde, hasta) usando el kernel SIMD cuando el tipo lo permite.
+    */
+    static constexpr void invertirRango(tipodato *desde, tipodato *hasta) {
+        const size_t n = hasta - desde;
+        const size_t hecho = std::is_constant_evaluated() ? 0 : cppvector_simd::invertir(desde, n);
+        std::reverse(desde + hecho, hasta - hecho);
+    }
+
+    /**
+    * @brief Rota los elementos k posiciones a la izquierda sin realocar (0 < k < tamano_).
+    *
+    * Para tipos trivialmente copiables, si el bloque más corto cabe en un búfer de pila se
+    * usa un memcpy + memmove; si no, la triple inversión recorre la memoria secuencialmente.
+    * El resto de los tipos (y la evaluación en tiempo de compilación) usa std::rotate.
+    */
+    constexpr void rotarBloques(size_t k) {
+        if constexpr (std::is_trivially_copyable_v<tipodato>) {
+            if (std::is_constant_evaluated()) {
+                std::rotate(datos_, datos_ + k, datos_ + tamano_);
+                return;
+            }
+            constexpr size_t bytes_bufer = 4096;
+            constexpr size_t max_bufer = bytes_bufer / sizeof(tipodato);
+            const size_t derecha = tamano_ - k;
+            if (k <= max_bufer) {
+                alignas(tipodato) unsigned char bufer[bytes_bufer];
+                std::memcpy(bufer, datos_, k * sizeof(tipodato));
+                std::memmove(datos_, datos_ + k, derecha * sizeof(tipodato));
+                std::memcpy(datos_ + derecha, bufer, k * sizeof(tipodato));
+            } else if (derecha <= max_bufer) {
+                alignas(tipodato) unsigned char bufer[bytes_bufer];
+                std::memcpy(bufer, datos_ + k, derecha * sizeof(tipodato));
+                std::memmove(datos_ + derecha, datos_, k * sizeof(tipodato));
+                std::memcpy(datos_, bufer, derecha * sizeof(tipodato));
+            } else {
+                invertirRango(datos_, datos_ + k);
+                invertirRango(datos_ + k, datos_ + tamano_);
+                invertirRango(datos_, datos_ + tamano_);
+            }
+        } else {
+            std::rotate(datos_, datos_ + k, datos_ + tamano_);
+        }
+    }
+
+    /**
+    * @brief Indica si el vector está ordenado y todos sus elementos son equivalentes.
+    *
+    * Se consulta antes de rotar: un vector ordenado rotado solo sigue ordenado en ese caso.
+    */
+    constexpr bool ordenadoUniforme() const {
+        if constexpr (comparable_) {
+            return ordenado_ && !(datos_[0] < datos_[tamano_ - 1]);
+        } else {
+            return false;
+        }
+    }
+
+    /**
+    * @brief Actualiza ordenado_ tras una rotación no trivial.
+    * @param uniforme Resultado de ordenadoUniforme() antes de rotar.
+    */
+    constexpr void ordenTrasRotar(bool uniforme) {
+        if constexpr (comparable_) {
+            if (ordenado_) {
+                ordenado_ = uniforme;
+            } else {
+                verificarOrden();
+            }
+        } else {
+            ordenado_ = false;
+        }
+    }
+
+    constexpr void verificarOrden() {
+        if (tamano_ <= 1) {
+            ordenado_ = true;
+            return;
+        }
+
+        for (size_t i = 1; i < tamano_; ++i) {
+            if (datos_[i] < datos_[i-1]) {
+                ordenado_ = false;
+                return;
+            }
+        }
+        ordenado_ = true;
+    }
+
+    /**
+    * @brief Actualiza `ordenado_` después de invertir el vector.
+    */
+    constexpr void ordenTrasInvertir() {
+        if constexpr (comparable_) {
+            if (ordenado_) {
+                // Un vector ascendente invertido solo sigue ordenado si todos sus elementos son iguales
+                ordenado_ = tamano_ <= 1 || !(datos_[tamano_ - 1] < datos_[0]);
+            } else {
+                verificarOrden();
+            }
+        } else {
+            ordenado_ = tamano_ <= 1;
+        }
+    }
+
+    /**
+    * @brief Actualiza ordenado_ tras agregar los elementos [desde, tamano_) al final.
+    */
+    constexpr void verificarOrdenLote(size_t desde) {
+        if (!ordenado_) return;
+        if constexpr (comparable_) {
+            for (size_t i = std::max<size_t>(desde, 1); i < tamano_; ++i) {
+                if (datos_[i] < datos_[i - 1]) {
+                    ordenado_ = false;
+                    return;
+                }
+            }
+        } else {
+            ordenado_ = tamano_ <= 1;
+        }
+    }
+
+    /**
+    * @brief Cuenta las apariciones de `dato` en [datos, datos + n) con el kernel SIMD y una cola escalar.
+    */
+    static constexpr size_t contarRango(const tipodato *datos, size_t n, const tipodato &dato) {
+        size_t contador = 0;
+        const size_t hecho = std::is_constant_evaluated() ? 0 : cppvector_simd::contar(datos, n, dato, contador);
+        for (size_t i = hecho; i < n; i++) {
+            if (datos[i] == dato) {
+                ++contador;
+            }
+        }
+        return contador;
+    }
+
+    /// < Tamaño en bytes a partir del cual llenar, copiar y reemplazar se reparte entre los hilos del pool
+    static constexpr size_t bytesParalelo_ = size_t(1) << 24;
+
+    /**
+    * @brief Indica si una operación masiva sobre n elementos conviene repartirla entre hilos.
+    */
+    static constexpr bool operacionParalela(size_t n) {
+        if (std::is_constant_evaluated()) return false;
+        return n * sizeof(tipodato) >= bytesParalelo_ && cppvector_paralelo::poolGlobal().obtenerHilos() > 1;
+    }
+
+    /**
+    * @brief Como operacionParalela, pero además exige que copiar no lance: si un bloque
+    *        fallara, los demás ya habrían construido elementos que nadie destruiría.
+    */
+    static constexpr bool construccionParalela(size_t n) {
+        if constexpr (std::is_nothrow_copy_constructible_v<tipodato>) {
+            return operacionParalela(n);
+        } else {
+            return false;
+        }
     }
 
-    void verificarOrden() {
-        if (tamano_ <= 1) {
-            ordenado_ = true;
+    /**
+    * @brief Construye n copias de `valor` en memoria sin inicializar, en paralelo por páginas si es grande.
+    */
+    constexpr void llenar(tipodato *destino, size_t n, const tipodato &valor) {
+        if (construccionParalela(n)) {
+            cppvector_paralelo::paraPaginas(destino, n, [&](size_t desde, size_t hasta) {
+                for (size_t i = desde; i < hasta; ++i) {
+                    alloc_construct(alloc, &destino[i], valor);
+                }
+            });
             return;
         }
-
-        for (size_t i = 1; i < tamano_; ++i) {
-            if (datos_[i] < datos_[i-1]) {
-                ordenado_ = false;
-                return;
-            }
+        for (size_t i = 0; i < n; i++) {
+            alloc_construct(alloc, &destino[i], valor);
         }
-        ordenado_ = true;
     }
 
 public:
@@ -1502,7 +2584,7 @@ public:
     *
     * @param dato Valor a eliminar.
     */
-    void eliminarDato(const tipodato& dato) {
+    constexpr void eliminarDato(const tipodato& dato) {
         for (size_t i = 0; i < tamano_; i++) {
             if (datos_[i] == dato) {
                 eliminar(i);
@@ -1513,15 +2595,12 @@ public:
 
     /**
      * @brief Muestra los elementos del vector por consola.
+     *
+     * Los tipos numéricos se escriben por bloques con std::to_chars, respetando la precisión
+     * y el estilo (fixed/scientific) de std::cout.
      */
     void mostrar() const {
-        for (size_t i = 0; i < tamano_; i++) {
-            std::cout << datos_[i];
-            if (i+1!=tamano_) {
-                std::cout<<" - ";
-            }
-        }
-        std::cout << "\n";
+        cppvector_formato::escribirFlujo<tipodato>(std::cout, datos_, tamano_, "", " - ", "\n");
     }
 
     /**
@@ -1529,7 +2608,7 @@ public:
      *
      * Solo ajusta el tamaño a cero.
      */
-    void vaciar() {
+    constexpr void vaciar() {
         for (size_t i = 0; i < tamano_; ++i) {
             alloc_destroy(alloc,&datos_[i]);
         }
@@ -1542,7 +2621,7 @@ public:
      *
      * @throws std::out_of_range si el vector está vacío.
      */
-    void eliminarFinal() {
+    constexpr void eliminarFinal() {
         if (tamano_ == 0) {
             throw std::out_of_range("No hay elementos en el vector");
         }
@@ -1553,14 +2632,14 @@ public:
     /**
      * @brief Elimina el elemento apuntado por un iterador.
      *
-     * Usa if constexpr para elegir entre memmove o std::move según el tipo.
+     * Usa memmove para tipos trivialmente copiables y std::move para el resto.
      *
      * @param it Iterador al elemento a eliminar.
      * @return Iterador al siguiente elemento.
      * @throws std::out_of_range si el iterador está fuera de rango.
      */
     template<typename U = tipodato>
-    Iterator erase(Iterator it) {
+    constexpr Iterator erase(Iterator it) {
         if (it.ptr < datos_ || it.ptr >= datos_ + tamano_)
             throw std::out_of_range("Iterador fuera de rango");
 
@@ -1568,9 +2647,7 @@ public:
 
         alloc_destroy(alloc, &datos_[idx]);
 
-        if constexpr (std::is_trivially_copyable_v<tipodato>) {
-            std::memmove(&datos_[idx], &datos_[idx + 1], sizeof(tipodato) * (tamano_ - idx - 1));
-        } else {
+        if (!moverMemoria(&datos_[idx], &datos_[idx + 1], tamano_ - idx - 1)) {
             for (size_t i = idx; i < tamano_ - 1; ++i) {
                 alloc_construct(alloc, &datos_[i], std::move(datos_[i + 1]));
                 alloc_destroy(alloc, &datos_[i + 1]);
@@ -1590,13 +2667,11 @@ public:
      * @return Iterador al siguiente elemento tras el borrado.
      */
     template<typename U = tipodato>
-    Iterator erase(Iterator first, Iterator last) {
+    constexpr Iterator erase(Iterator first, Iterator last) {
         if (first == last) return first;
         size_t start = first - begin(), end = last - begin(), count = end - start;
 
-        if constexpr (std::is_trivially_copyable_v<tipodato>) {
-            std::memmove(&datos_[start], &datos_[end], sizeof(tipodato) * (tamano_ - end));
-        } else {
+        if (!moverMemoria(&datos_[start], &datos_[end], tamano_ - end)) {
             for (size_t i = start; i < end; ++i) {
                 alloc_destroy(alloc, &datos_[i]);
             }
@@ -1619,20 +2694,17 @@ public:
     * @param dato Valor a insertar.
     * @throws std::out_of_range si el índice está fuera de rango.
     */
-    void insertar(size_t indice, const tipodato& dato) {
+    constexpr void insertar(size_t indice, const tipodato& dato) {
         if (indice > tamano_) throw std::out_of_range("Indice fuera de rango");
         if (tamano_ == capacidad_) cambiarCapacidad(capacidad_ == 0 ? 1 : capacidad_ * 2);
 
-        if constexpr (std::is_trivially_copyable_v<tipodato>) {
-            std::memmove(&datos_[indice + 1], &datos_[indice], sizeof(tipodato) * (tamano_ - indice));
-            alloc_construct(alloc, &datos_[indice], dato);
-        } else {
+        if (!moverMemoria(&datos_[indice + 1], &datos_[indice], tamano_ - indice)) {
             for (size_t i = tamano_; i > indice; --i) {
                 alloc_construct(alloc, &datos_[i], std::move(datos_[i - 1]));
                 alloc_destroy(alloc, &datos_[i - 1]);
             }
-            alloc_construct(alloc, &datos_[indice], dato);
         }
+        alloc_construct(alloc, &datos_[indice], dato);
         ++tamano_;
         ordenado_ = false;
     }
@@ -1644,7 +2716,7 @@ public:
     * @throws std::out_of_range si el índice está fuera de rango.
     */
 
-    void eliminar(size_t indice) {
+    constexpr void eliminar(size_t indice) {
         if (indice >= tamano_) {
             throw std::out_of_range("Indice fuera de rango");
         }
@@ -1665,7 +2737,7 @@ public:
     * @param dato Valor a buscar.
     * @return true si se encuentra el valor, false en caso contrario.
     */
-    bool contiene(const tipodato &dato) const {
+    constexpr bool contiene(const tipodato &dato) const {
         for (size_t i = 0; i < tamano_; i++) {
             if (datos_[i] == dato) {
                 return true;
@@ -1680,7 +2752,7 @@ public:
     * @param dato Valor a buscar.
     * @return Índice del valor si se encuentra, -1 en caso contrario.
     */
-    int buscar(const tipodato &dato) const {
+    constexpr int buscar(const tipodato &dato) const {
         for (size_t i = 0; i < tamano_; i++) {
             if (datos_[i] == dato) {
                 return static_cast<int>(i);
@@ -1696,7 +2768,7 @@ public:
     * @return Copia del valor en la posición indicada.
     * @throws std::out_of_range si el índice es inválido.
     */
-    tipodato obtener(size_t indice) const {
+    constexpr tipodato obtener(size_t indice) const {
         if (indice >= tamano_) throw std::out_of_range("Indice fuera de rango");
         return datos_[indice];
     }
@@ -1708,7 +2780,7 @@ public:
     *
     * @param nuevaCapacidad Nueva capacidad deseada.
     */
-    void reservar(size_t nuevaCapacidad) {
+    constexpr void reservar(size_t nuevaCapacidad) {
         if (nuevaCapacidad > capacidad_) {
             cambiarCapacidad(nuevaCapacidad);
         }
@@ -1719,7 +2791,7 @@ public:
     *
     * Libera memoria sobrante si existe.
     */
-    void reducirCapacidad() {
+    constexpr void reducirCapacidad() {
         if (capacidad_ > tamano_) {
             if (tamano_ == 0) { 
                 alloc.deallocate(datos_, capacidad_);
@@ -1755,7 +2827,7 @@ public:
     * @brief Intercambia el contenido de este vector con otro.
     * @param otro Vector con el cual se intercambiarán los datos.
     */
-    void intercambiar(Vector &otro) {
+    constexpr void intercambiar(Vector &otro) {
         std::swap(datos_, otro.datos_);
         std::swap(tamano_, otro.tamano_);
         std::swap(capacidad_, otro.capacidad_);
@@ -1767,7 +2839,7 @@ public:
     * @return Referencia al elemento frontal.
     * @throws std::out_of_range Si el vector está vacío.
     */
-    tipodato &frente() {
+    constexpr tipodato &frente() {
         if (tamano_==0) throw std::out_of_range("No hay elementos en el vector");
         return datos_[0];
     }
@@ -1777,7 +2849,7 @@ public:
     * @return Referencia constante al elemento frontal.
     * @throws std::out_of_range Si el vector está vacío.
     */
-    const tipodato &frente() const {
+    constexpr const tipodato &frente() const {
         if (tamano_==0) throw std::out_of_range("No hay elementos en el vector");
         return datos_[0];
     }
@@ -1787,7 +2859,7 @@ public:
      * @return Referencia al elemento trasero.
      * @throws std::out_of_range Si el vector está vacío.
      */
-    tipodato &atras() {
+    constexpr tipodato &atras() {
         if (tamano_==0) throw std::out_of_range("No hay elementos en el vector");
         return datos_[tamano_-1];
     }
@@ -1797,7 +2869,7 @@ public:
     * @return Referencia constante al elemento trasero.
     * @throws std::out_of_range Si el vector está vacío.
     */
-    const tipodato &atras() const {
+    constexpr const tipodato &atras() const {
         if (tamano_==0) throw std::out_of_range("No hay elementos en el vector");
         return datos_[tamano_-1];
     }
@@ -1805,25 +2877,20 @@ public:
     /**
     * @brief Invierte el orden de los elementos en el vector.
     */
-    void invertir() {
-        for (size_t i = 0; i < tamano_/2; i++) {
-            tipodato aux = datos_[i];
-            datos_[i] = datos_[tamano_-i-1];
-            datos_[tamano_-i-1] = aux;
-        }
-        ordenado_ = false;
+    constexpr void invertir() {
+        invertirRango(datos_, datos_ + tamano_);
+        ordenTrasInvertir();
     }
 
     /**
     * @brief Ordena el vector usando el algoritmo de burbuja (O(n^2)).
     */
-    void ordenarBurbuja() {
+    constexpr void ordenarBurbuja() {
         for (size_t i = 0; i < tamano_; i++) {
             for (size_t j = i+1; j < tamano_; j++) {
                 if (datos_[i] > datos_[j]) {
-                    tipodato aux = datos_[i];
-                    datos_[i] = datos_[j];
-                    datos_[j] = aux;
+                    using std::swap;
+                    swap(datos_[i], datos_[j]);
                 }
             }
         }
@@ -1834,7 +2901,7 @@ public:
     * @brief Ordena el vector usando el algoritmo IntroSort (a través de std::sort).
     * Complejidad temporal: O(n log n)
     */
-    void ordenar() {
+    constexpr void ordenar() {
         std::sort(begin(),end());
         ordenado_ = true;
     }
@@ -1846,36 +2913,81 @@ public:
     * @return Subvector con los elementos seleccionados.
     * @throws std::out_of_range Si los índices no son válidos.
     */
-    Vector subvector(size_t desde, size_t hasta) const {
-        if (desde >= hasta || hasta > tamano_ || desde > tamano_) {
-            return Vector{};
-        }
-        Vector nuevo;
-        nuevo.reservar(hasta - desde);
-        for (size_t i = desde; i < hasta; ++i) {
-            nuevo.agregarFinal(datos_[i]);
+    constexpr Vector subvector(size_t desde, size_t hasta) const {
+        Vector nuevo(subvectorVista(desde, hasta));
+        if constexpr (comparable_) {
+            if (!nuevo.ordenado_) {
+                nuevo.verificarOrden();
+            }
         }
         return nuevo;
     }
 
+    /**
+    * @brief Crea una vista de solo lectura sobre un rango de índices, sin copiar (O(1)).
+    *
+    * La vista hereda el estado de orden del vector.
+    *
+    * @param desde Índice de inicio (inclusive).
+    * @param hasta Índice de fin (exclusive).
+    * @return Vista de los elementos seleccionados (vacía si los índices no son válidos).
+    */
+    constexpr VectorView<tipodato> subvectorVista(size_t desde, size_t hasta) const noexcept {
+        return vista().subvista(desde, hasta);
+    }
+
+    /**
+    * @brief Crea una vista de solo lectura sobre todo el vector (O(1)).
+    * @return Vista de todos los elementos.
+    */
+    constexpr VectorView<tipodato> vista() const noexcept {
+        return VectorView<tipodato>(datos_, tamano_, ordenado_);
+    }
+
+    /**
+    * @brief Copia los elementos en un std::array de N elementos.
+    *
+    * La memoria de un Vector creado durante la evaluación constante debe liberarse antes de
+    * que termine; copiarlo a un std::array permite guardar la tabla en una variable constexpr:
+    * `constexpr auto tabla = [] { Vector<int> v; ...; return v.aArreglo<256>(); }();`
+    *
+    * @tparam N Cantidad de elementos (debe coincidir con el tamaño).
+    * @throws std::out_of_range si el tamaño no es N.
+    */
+    template<size_t N>
+    constexpr std::array<tipodato, N> aArreglo() const {
+        if (tamano_ != N) throw std::out_of_range("El tamaño no coincide con N");
+        std::array<tipodato, N> arreglo{};
+        std::copy(datos_, datos_ + tamano_, arreglo.begin());
+        return arreglo;
+    }
+
     /**
     * @brief Reemplaza todas las apariciones de un dato por otro.
     * @param dato Valor a reemplazar.
     * @param nuevo Nuevo valor.
     */
-    void reemplazar(const tipodato &dato, const tipodato &nuevo) {
-        for (size_t i = 0; i < tamano_; i++) {
+    constexpr void reemplazar(const tipodato &dato, const tipodato &nuevo) {
+        if (operacionParalela(tamano_)) {
+            reemplazar(cppvector_paralelo::par, dato, nuevo);
+            return;
+        }
+
+        const size_t hecho = std::is_constant_evaluated() ? 0 : cppvector_simd::reemplazar(datos_, tamano_, dato, nuevo);
+        for (size_t i = hecho; i < tamano_; i++) {
             if (datos_[i] == dato) {
                 datos_[i] = nuevo;
             }
         }
-        ordenado_ = false;
+        if (tamano_ > 1) {
+            ordenado_ = false;
+        }
     }
 
     /**
     * @brief Elimina todos los elementos duplicados del vector.
     */
-    void eliminarDuplicados() {
+    constexpr void eliminarDuplicados() {
         if (!estaOrdenado()) {
             std::sort(begin(), end());
             ordenado_ = true;
@@ -1888,20 +3000,14 @@ public:
     * @param dato Valor a contar.
     * @return Número de apariciones del valor.
     */
-    size_t contar(const tipodato &dato) const {
-        size_t contador = 0;
-        for (size_t i = 0; i < tamano_; i++) {
-            if (datos_[i] == dato) {
-                ++contador;
-            }
-        }
-        return contador;
+    constexpr size_t contar(const tipodato &dato) const {
+        return contarRango(datos_, tamano_, dato);
     }
 
     /**
     * @brief Reduce la capacidad si el tamaño es menor a la mitad de la capacidad actual.
     */
-    void ajustarCapacidad() {
+    constexpr void ajustarCapacidad() {
         if (tamano_<capacidad_/2) {
             reducirCapacidad();
         }
@@ -1913,12 +3019,99 @@ public:
     * @param j Índice del segundo elemento.
     * @throws std::out_of_range Si alguno de los índices es inválido.
     */
-    void intercambiarIndices(size_t i, size_t j) {
+    constexpr void intercambiarIndices(size_t i, size_t j) {
         if (i>=tamano_||j>=tamano_) throw std::out_of_range("Indice fuera de rango");
-        tipodato aux = datos_[i];
-        datos_[i] = datos_[j];
-        datos_[j] = aux;
-        ordenado_ = false;
+        if (i == j) return;
+        bool equivalentes = false;
+        if constexpr (comparable_) {
+            // Intercambiar dos elementos equivalentes no altera el orden
+            equivalentes = !(datos_[i] < datos_[j]) && !(datos_[j] < datos_[i]);
+        }
+        using std::swap;
+        swap(datos_[i], datos_[j]);
+        ordenado_ = ordenado_ && equivalentes;
+    }
+
+    /**
+    * @brief Rota los elementos k posiciones hacia la izquierda.
+    *
+    * El elemento en la posición k pasa a ser el primero. No realoca memoria.
+    *
+    * @param k Número de posiciones (se toma módulo el tamaño).
+    */
+    constexpr void rotarIzquierda(size_t k) {
+        if (tamano_ <= 1 || (k %= tamano_) == 0) return;
+        const bool uniforme = ordenadoUniforme();
+        rotarBloques(k);
+        ordenTrasRotar(uniforme);
+    }
+
+    /**
+    * @brief Rota los elementos k posiciones hacia la derecha.
+    *
+    * El último elemento pasa a ocupar la posición k - 1. No realoca memoria.
+    *
+    * @param k Número de posiciones (se toma módulo el tamaño).
+    */
+    constexpr void rotarDerecha(size_t k) {
+        if (tamano_ <= 1 || (k %= tamano_) == 0) return;
+        const bool uniforme = ordenadoUniforme();
+        rotarBloques(tamano_ - k);
+        ordenTrasRotar(uniforme);
+    }
+
+    /**
+    * @brief Desplaza los elementos k posiciones hacia la izquierda manteniendo el tamaño.
+    *
+    * Los k primeros elementos se descartan y las k posiciones libres al final se rellenan.
+    *
+    * @param k Número de posiciones.
+    * @param relleno Valor para las posiciones liberadas (por defecto tipodato()).
+    */
+    constexpr void desplazarIzquierda(size_t k, const tipodato &relleno = tipodato()) {
+        if (k == 0 || tamano_ == 0) return;
+        k = std::min(k, tamano_);
+        const size_t restantes = tamano_ - k;
+        // relleno puede ser uno de los elementos que se van a mover
+        const tipodato valor = relleno;
+
+        if (!moverMemoria(datos_, datos_ + k, restantes)) {
+            std::move(datos_ + k, datos_ + tamano_, datos_);
+        }
+        std::fill(datos_ + restantes, datos_ + tamano_, valor);
+
+        if constexpr (comparable_) {
+            ordenado_ = ordenado_ && (restantes == 0 || !(valor < datos_[restantes - 1]));
+        } else {
+            ordenado_ = tamano_ <= 1;
+        }
+    }
+
+    /**
+    * @brief Desplaza los elementos k posiciones hacia la derecha manteniendo el tamaño.
+    *
+    * Los k últimos elementos se descartan y las k posiciones libres al inicio se rellenan.
+    *
+    * @param k Número de posiciones.
+    * @param relleno Valor para las posiciones liberadas (por defecto tipodato()).
+    */
+    constexpr void desplazarDerecha(size_t k, const tipodato &relleno = tipodato()) {
+        if (k == 0 || tamano_ == 0) return;
+        k = std::min(k, tamano_);
+        const size_t restantes = tamano_ - k;
+        // relleno puede ser uno de los elementos que se van a mover
+        const tipodato valor = relleno;
+
+        if (!moverMemoria(datos_ + k, datos_, restantes)) {
+            std::move_backward(datos_, datos_ + restantes, datos_ + tamano_);
+        }
+        std::fill(datos_, datos_ + k, valor);
+
+        if constexpr (comparable_) {
+            ordenado_ = ordenado_ && (restantes == 0 || !(datos_[k] < valor));
+        } else {
+            ordenado_ = tamano_ <= 1;
+        }
     }
 
     /**
@@ -1927,7 +3120,7 @@ public:
     * @param v Vector a insertar.
     * @throws std::out_of_range Si el índice es inválido.
     */
-    void insertarVector(size_t indice, const Vector &v) {
+    constexpr void insertarVector(size_t indice, const Vector &v) {
         if (indice > tamano_) throw std::out_of_range("Indice fuera de rango");
         Vector copia = v;
 
@@ -1951,6 +3144,314 @@ public:
         ordenado_ = false;
     }
 
+    //
+    //  EJECUCION PARALELA
+    //
+
+    /**
+    * @brief Cuenta las apariciones de un dato repartiendo el vector entre los hilos del pool.
+    *
+    * Cada bloque se cuenta con el kernel SIMD. Con `cppvector_paralelo::seq` equivale a `contar(dato)`.
+    *
+    * @param politica seq, par o par_unseq.
+    * @param dato Valor a contar.
+    */
+    template<cppvector_paralelo::PoliticaEjecucion Politica>
+    size_t contar(Politica politica, const tipodato &dato) const {
+        (void) politica;
+        if constexpr (cppvector_paralelo::es_secuencial_v<Politica>) {
+            return contar(dato);
+        } else {
+            std::atomic<size_t> total{0};
+            cppvector_paralelo::paraRango(tamano_, 0, [&](size_t desde, size_t hasta) {
+                total.fetch_add(contarRango(datos_ + desde, hasta - desde, dato), std::memory_order_relaxed);
+            });
+            return total.load(std::memory_order_relaxed);
+        }
+    }
+
+    /**
+    * @brief Verifica en paralelo si el vector contiene un valor.
+    *
+    * Los bloques que empiezan después de encontrar el valor terminan sin recorrer nada.
+    *
+    * @param politica seq, par o par_unseq.
+    * @param dato Valor a buscar.
+    */
+    template<cppvector_paralelo::PoliticaEjecucion Politica>
+    bool contiene(Politica politica, const tipodato &dato) const {
+        (void) politica;
+        if constexpr (cppvector_paralelo::es_secuencial_v<Politica>) {
+            return contiene(dato);
+        } else {
+            std::atomic<bool> encontrado{false};
+            cppvector_paralelo::paraRango(tamano_, 0, [&](size_t desde, size_t hasta) {
+                if (encontrado.load(std::memory_order_relaxed)) return;
+                const size_t n = hasta - desde;
+                for (size_t i = cppvector_simd::buscar(datos_ + desde, n, dato); i < n; ++i) {
+                    if (datos_[desde + i] == dato) {
+                        encontrado.store(true, std::memory_order_relaxed);
+                        return;
+                    }
+                }
+            });
+            return encontrado.load(std::memory_order_relaxed);
+        }
+    }
+
+    /**
+    * @brief Reemplaza en paralelo todas las apariciones de un dato por otro.
+    *
+    * @param politica seq, par o par_unseq.
+    * @param dato Valor a reemplazar.
+    * @param nuevo Nuevo valor.
+    */
+    template<cppvector_paralelo::PoliticaEjecucion Politica>
+    void reemplazar(Politica politica, const tipodato &dato, const tipodato &nuevo) {
+        (void) politica;
+        if (cppvector_paralelo::es_secuencial_v<Politica>) {
+            reemplazar(dato, nuevo);
+            return;
+        }
+        cppvector_paralelo::paraPaginas(datos_, tamano_, [&](size_t desde, size_t hasta) {
+            tipodato *bloque = datos_ + desde;
+            const size_t n = hasta - desde;
+            for (size_t i = cppvector_simd::reemplazar(bloque, n, dato, nuevo); i < n; ++i) {
+                if (bloque[i] == dato) {
+                    bloque[i] = nuevo;
+                }
+            }
+        });
+        if (tamano_ > 1) {
+            ordenado_ = false;
+        }
+    }
+
+    /**
+    * @brief Invierte el orden de los elementos intercambiando en paralelo bloques de pares (i, n-1-i).
+    * @param politica seq, par o par_unseq.
+    */
+    template<cppvector_paralelo::PoliticaEjecucion Politica>
+    void invertir(Politica politica) {
+        (void) politica;
+        if constexpr (cppvector_paralelo::es_secuencial_v<Politica>) {
+            invertir();
+        } else {
+            const size_t n = tamano_;
+            cppvector_paralelo::paraRango(n / 2, 0, [&](size_t desde, size_t hasta) {
+                std::swap_ranges(datos_ + desde, datos_ + hasta, std::reverse_iterator<tipodato *>(datos_ + n - desde));
+            });
+            ordenTrasInvertir();
+        }
+    }
+
+    /**
+    * @brief Ordena el vector en paralelo.
+    *
+    * Ordena un bloque por hilo (con varios bloques por hilo para equilibrar la carga) y luego
+    * mezcla los bloques de a pares, también en paralelo, hasta que queda uno solo.
+    *
+    * @param politica seq, par o par_unseq.
+    */
+    template<cppvector_paralelo::PoliticaEjecucion Politica>
+    void ordenar(Politica politica) {
+        (void) politica;
+        if constexpr (cppvector_paralelo::es_secuencial_v<Politica>) {
+            ordenar();
+        } else {
+            const size_t bloques = std::min(cppvector_paralelo::poolGlobal().obtenerHilos() * 4,
+                                            std::max<size_t>(tamano_ / 4096, 1));
+            const size_t n = tamano_;
+            auto limite = [n, bloques](size_t b) { return b * n / bloques; };
+
+            cppvector_paralelo::paraRango(bloques, 1, [&](size_t primero, size_t ultimo) {
+                for (size_t b = primero; b < ultimo; ++b) {
+                    std::sort(datos_ + limite(b), datos_ + limite(b + 1));
+                }
+            });
+            for (size_t ancho = 1; ancho < bloques; ancho *= 2) {
+                const size_t pares = (bloques + 2 * ancho - 1) / (2 * ancho);
+                cppvector_paralelo::paraRango(pares, 1, [&](size_t primero, size_t ultimo) {
+                    for (size_t p = primero; p < ultimo; ++p) {
+                        const size_t izquierda = p * 2 * ancho;
+                        const size_t medio = std::min(izquierda + ancho, bloques);
+                        const size_t derecha = std::min(izquierda + 2 * ancho, bloques);
+                        std::inplace_merge(datos_ + limite(izquierda), datos_ + limite(medio), datos_ + limite(derecha));
+                    }
+                });
+            }
+            ordenado_ = true;
+        }
+    }
+
+    /**
+    * @brief Elimina los duplicados ordenando en paralelo; la compactación final es secuencial.
+    * @param politica seq, par o par_unseq.
+    */
+    template<cppvector_paralelo::PoliticaEjecucion Politica>
+    void eliminarDuplicados(Politica politica) {
+        ordenar(politica);
+        eliminarDuplicados();
+    }
+
+    //
+    //  LECTURA DE TEXTO
+    //
+
+    /**
+    * @brief Crea un Vector con los números de un texto, separados por `delimitador` o por saltos de línea.
+    *
+    * Cuenta los separadores con SIMD para reservar una sola vez y convierte cada campo con
+    * std::from_chars, sin flujos ni locale. Se ignoran los espacios alrededor de cada número,
+    * las líneas vacías y un separador final.
+    *
+    * @param texto Texto a leer, por ejemplo "1,2,3" o "1.5\n2.5\n".
+    * @param delimitador Separador de campos además del salto de línea.
+    * @return Vector con los números leídos.
+    * @throws cppvector_texto::ErrorAnalisis con la posición y la línea del primer campo inválido.
+    */
+    static Vector analizar(std::string_view texto, char delimitador = ',')
+        requires cppvector_simd::es_aritmetico_v<tipodato> {
+        Vector resultado;
+        resultado.reservar(cppvector_texto::contarSeparadores(texto.data(), texto.size(), delimitador) + 1);
+        size_t linea = 1;
+        cppvector_texto::analizar<tipodato>(texto, delimitador, 0, linea, [&](tipodato valor) {
+            resultado.agregarFinal(valor);
+        });
+        return resultado;
+    }
+
+    /**
+    * @brief Lee los números de un archivo abierto, en bloques de 1 MiB, desde su posición actual.
+    *
+    * Cada bloque se analiza hasta su último separador y el resto pasa al bloque siguiente, así
+    * que la memoria usada no depende del tamaño del archivo. Si el archivo admite fseek, la
+    * densidad de campos del primer bloque se usa para estimar el total y reservar una sola vez.
+    *
+    * @throws cppvector_texto::ErrorAnalisis con la posición (desde el punto de partida) y la línea.
+    * @throws std::runtime_error si falla la lectura.
+    */
+    static Vector analizarArchivo(std::FILE *archivo, char delimitador = ',')
+        requires cppvector_simd::es_aritmetico_v<tipodato> {
+        constexpr size_t bloque = size_t(1) << 20;
+        const char separadores[2] = {delimitador, '\n'};
+
+        long restante = -1;
+        const long inicio = std::ftell(archivo);
+        if (inicio >= 0 && std::fseek(archivo, 0, SEEK_END) == 0) {
+            restante = std::ftell(archivo) - inicio;
+            std::fseek(archivo, inicio, SEEK_SET);
+        }
+
+        Vector resultado;
+        Vector<char> buffer;
+        size_t base = 0, linea = 1;
+        bool estimado = false;
+        auto agregar = [&](tipodato valor) { resultado.agregarFinal(valor); };
+        while (true) {
+            const size_t pendiente = buffer.obtenerTamano();
+            const size_t leidos = std::fread(buffer.agregarSinInicializar(bloque), 1, bloque, archivo);
+            buffer.redimensionar(pendiente + leidos);
+            if (leidos < bloque && std::ferror(archivo)) throw std::runtime_error("Error al leer el archivo");
+            const bool terminado = leidos < bloque;
+
+            const std::string_view texto(buffer.data(), buffer.obtenerTamano());
+            // Un campo cortado por el final del bloque se completa con el bloque siguiente
+            const size_t ultimo = texto.find_last_of(std::string_view(separadores, 2));
+            const size_t corte = terminado ? texto.size() : (ultimo == std::string_view::npos ? 0 : ultimo + 1);
+            if (!estimado && corte > 0) {
+                estimado = true;
+                const size_t campos = cppvector_texto::contarSeparadores(texto.data(), corte, delimitador) + 1;
+                resultado.reservar(restante > 0 ? campos * (static_cast<size_t>(restante) / corte + 1) : campos);
+            }
+            cppvector_texto::analizar<tipodato>(texto.substr(0, corte), delimitador, base, linea, agregar);
+
+            base += corte;
+            std::memmove(buffer.data(), buffer.data() + corte, texto.size() - corte);
+            buffer.redimensionar(texto.size() - corte);
+            if (terminado) return resultado;
+        }
+    }
+
+    /**
+    * @brief Lee los números del archivo en `ruta`.
+    * @throws std::runtime_error si el archivo no puede abrirse.
+    */
+    static Vector analizarArchivo(const std::string &ruta, char delimitador = ',')
+        requires cppvector_simd::es_aritmetico_v<tipodato> {
+        std::unique_ptr<std::FILE, int (*)(std::FILE *)> archivo(std::fopen(ruta.c_str(), "rb"), &std::fclose);
+        if (!archivo) throw std::runtime_error("No se pudo abrir " + ruta);
+        return analizarArchivo(archivo.get(), delimitador);
+    }
+
+    //
+    //  ESCRITURA DE TEXTO
+    //
+
+    /**
+    * @brief Convierte los elementos a texto por bloques de 16 KiB y entrega cada bloque a `funcion`.
+    *
+    * Usa std::to_chars sobre un bloque en la pila, sin flujos ni memoria dinámica, así que la
+    * memoria usada no depende del tamaño del vector. Los tipos de carácter se escriben como números.
+    *
+    * @param funcion Invocable con (std::string_view) que recibe cada bloque.
+    * @param formato Delimitadores, estilo y precisión; por defecto "[1, 2, 3]" con la
+    *                representación más corta de cada número.
+    */
+    template<typename Funcion>
+    void formatearPorBloques(Funcion &&funcion, const cppvector_formato::Formato &formato = {}) const
+        requires cppvector_formato::formateable_v<tipodato> {
+        cppvector_formato::escribirBloques(datos_, tamano_, formato, [&](const char *texto, size_t bytes) {
+            funcion(std::string_view(texto, bytes));
+        });
+    }
+
+    /**
+    * @brief Escribe el texto en un iterador de salida de char, por ejemplo un buffer ya reservado.
+    * @return Iterador al final del texto escrito.
+    */
+    template<std::output_iterator<char> It>
+    It formatearEn(It salida, const cppvector_formato::Formato &formato = {}) const
+        requires cppvector_formato::formateable_v<tipodato> {
+        formatearPorBloques([&](std::string_view bloque) {
+            salida = std::copy(bloque.begin(), bloque.end(), salida);
+        }, formato);
+        return salida;
+    }
+
+    /**
+    * @brief Devuelve el texto de los elementos en un std::string.
+    */
+    std::string aTexto(const cppvector_formato::Formato &formato = {}) const
+        requires cppvector_formato::formateable_v<tipodato> {
+        std::string texto;
+        formatearPorBloques([&](std::string_view bloque) { texto.append(bloque); }, formato);
+        return texto;
+    }
+
+    /**
+    * @brief Escribe el texto en un FILE* con un fwrite por bloque.
+    * @throws std::runtime_error si falla la escritura.
+    */
+    void escribirEn(std::FILE *archivo, const cppvector_formato::Formato &formato = {}) const
+        requires cppvector_formato::formateable_v<tipodato> {
+        formatearPorBloques([&](std::string_view bloque) {
+            if (std::fwrite(bloque.data(), 1, bloque.size(), archivo) != bloque.size()) {
+                throw std::runtime_error("Error al escribir el vector");
+            }
+        }, formato);
+    }
+
+    /**
+    * @brief Escribe el texto en un flujo con un write por bloque (ignora el formato del flujo).
+    */
+    void escribirEn(std::ostream &os, const cppvector_formato::Formato &formato = {}) const
+        requires cppvector_formato::formateable_v<tipodato> {
+        formatearPorBloques([&](std::string_view bloque) {
+            os.write(bloque.data(), static_cast<std::streamsize>(bloque.size()));
+        }, formato);
+    }
+
     /** @name Métodos compatibles con std::vector
     *Métodos alternativos con nombres en inglés para facilitar la interoperabilidad.
     */
@@ -1961,27 +3462,27 @@ public:
     * @param newSize New size of the vector.
     * @param value Value used to initialize the new elements (if any).
     */
-    void resize(size_t newSize, const tipodato &value = tipodato()) {
+    constexpr void resize(size_t newSize, const tipodato &value = tipodato()) {
         redimensionar(newSize, value);
     }
     /**
     * @brief Adds a value at the end of the vector.
     * @param value Value to be added.
     */
-    void push_back(const tipodato &value) {
+    constexpr void push_back(const tipodato &value) {
         agregarFinal(value);
     }
     /**
     * @brief Removes the last element of the vector.
     */
-    void pop_back() {
+    constexpr void pop_back() {
         eliminarFinal();
     }
     /**
     * @brief Reserves a new capacity for the vector.
     * @param newCapacity Minimum desired capacity.
     */
-    void reserve(size_t newCapacity) {
+    constexpr void reserve(size_t newCapacity) {
         reservar(newCapacity);
     }
 
@@ -1991,7 +3492,7 @@ public:
     * @param val Value to insert.
     * @return Iterator pointing to the newly inserted element.
     */
-    Iterator insert(Iterator pos, const tipodato& val) {
+    constexpr Iterator insert(Iterator pos, const tipodato& val) {
         size_t idx = pos - begin();
         insert(idx, val);
         ordenado_ = false;
@@ -2002,19 +3503,19 @@ public:
     * @param index Index where the value will be inserted.
     * @param value Value to insert.
     */
-    void insert(size_t index, const tipodato &value) {
+    constexpr void insert(size_t index, const tipodato &value) {
         insertar(index,value);
     }
     /**
     * @brief Removes the element at the specified index.
     * @param index Index of the element to be removed.
     */
-    void erase(size_t index) {
+    constexpr void erase(size_t index) {
         eliminar(index);
     }
 
     template<typename InputIterator>
-    Iterator insert(Iterator pos, InputIterator first, InputIterator last) {
+    constexpr Iterator insert(Iterator pos, InputIterator first, InputIterator last) {
         size_t idx = pos - begin();
         size_t count = std::distance(first, last);
 
@@ -2045,76 +3546,82 @@ public:
     * @brief Swaps the contents with another vector.
     * @param other Vector with which to swap contents.
     */
-    void swap(Vector &other) noexcept {
+    constexpr void swap(Vector &other) noexcept {
         intercambiar(other);
     }
     /**
     * @brief Direct access to the internal memory block.
     * @return Pointer to the data.
     */
-    tipodato *data() noexcept {
+    constexpr tipodato *data() noexcept {
         return datos_;
     }
     /**
     * @brief Constant direct access to the internal memory block.
     * @return Constant pointer to the data.
     */
-    const tipodato *data() const noexcept {
+    constexpr const tipodato *data() const noexcept {
         return datos_;
     }
     /**
     * @brief Returns a reference to the first element.
     * @return Reference to the first element.
     */
-    tipodato &front() {
+    constexpr tipodato &front() {
         return frente();
     }
     /**
     * @brief Returns a reference to the last element.
     * @return Reference to the last element.
     */
-    tipodato &back() {
+    constexpr tipodato &back() {
         return atras();
     }
     /**
     * @brief Reduces the capacity to match the current size.
     */
-    void shrink_to_fit() {
+    constexpr void shrink_to_fit() {
         reducirCapacidad();
     }
     /**
     * @brief Returns the number of elements currently stored in the vector.
     * @return Size of the vector.
     */
-    [[nodiscard]] size_t size() const {
+    [[nodiscard]] constexpr size_t size() const {
         return tamano_;
     }
     /**
     * @brief Returns the current capacity of the vector.
     * @return Capacity of the vector.
     */
-    [[nodiscard]] size_t capacity() const {
+    [[nodiscard]] constexpr size_t capacity() const {
         return capacidad_;
     }
     /**
     * @brief Checks whether the vector is empty.
     * @return true if the vector is empty, false otherwise.
     */
-    [[nodiscard]] bool empty() const {
+    [[nodiscard]] constexpr bool empty() const {
         return tamano_ == 0;
     }
     /**
      * @brief Checks whether the vector is sorted.
      * @return true if the vector is sorted.
      */
-    [[nodiscard]] bool isSorted() const {
+    [[nodiscard]] constexpr bool isSorted() const {
         return ordenado_;
     }
+    /**
+     * @brief Recomputes the sorted flag after writing elements through data().
+     */
+    constexpr void recheck_sorted() {
+        revisarOrden();
+    }
     /**
     * @brief Returns the maximum number of elements that the vector can theoretically hold.
     * @return Maximum size supported by the system.
     */
-    size_t static max_size() {
+    static constexpr size_t max_size() {
         return std::numeric_limits<size_t>::max();
     }
     /**
@@ -2126,13 +3633,13 @@ public:
     /**
     * @brief Removes all duplicate values in the vector.
     */
-    void remove_duplicates() {
+    constexpr void remove_duplicates() {
         eliminarDuplicados();
     }
     /**
     * @brief Reverses the order of the elements in the vector.
     */
-    void reverse() {
+    constexpr void reverse() {
         invertir();
     }
     /**
@@ -2141,7 +3648,7 @@ public:
     * @param indexB Index of the second element.
     * @return 1 if swapped successfully, 0 or error code otherwise.
     */
-    void swap_indices(size_t indexA, size_t indexB) {
+    constexpr void swap_indices(size_t indexA, size_t indexB) {
         intercambiarIndices(indexA, indexB);
     }
     /**
@@ -2150,7 +3657,7 @@ public:
     * @param newValue Replacement value.
     * @return Number of elements replaced.
     */
-    void replace_all(const tipodato& oldValue, const tipodato& newValue) {
+    constexpr void replace_all(const tipodato& oldValue, const tipodato& newValue) {
     reemplazar(oldValue, newValue);
     }
     /**
@@ -2159,33 +3666,149 @@ public:
     * @param to Ending index (exclusive).
     * @return A new Vector containing the selected range.
     */
-    Vector slice(const size_t from, const size_t to) const {
+    constexpr Vector slice(const size_t from, const size_t to) const {
         return subvector(from, to);
     }
     /**
+    * @brief Rotates the elements k positions to the left (element k becomes the first one).
+    * @param k Number of positions (taken modulo the size).
+    */
+    constexpr void rotate(size_t k) {
+        rotarIzquierda(k);
+    }
+    /**
+    * @brief Rotates the elements k positions to the right (the last element moves to k - 1).
+    * @param k Number of positions (taken modulo the size).
+    */
+    constexpr void rotate_right(size_t k) {
+        rotarDerecha(k);
+    }
+    /**
+    * @brief Shifts the elements k positions to the left, keeping the size.
+    * @param k Number of positions.
+    * @param fill Value written to the vacated positions at the end.
+    */
+    constexpr void shift_left(size_t k, const tipodato &fill = tipodato()) {
+        desplazarIzquierda(k, fill);
+    }
+    /**
+    * @brief Shifts the elements k positions to the right, keeping the size.
+    * @param k Number of positions.
+    * @param fill Value written to the vacated positions at the beginning.
+    */
+    constexpr void shift_right(size_t k, const tipodato &fill = tipodato()) {
+        desplazarDerecha(k, fill);
+    }
+    /**
+    * @brief Creates a read-only view over [from, to) without copying (O(1)).
+    * @param from Starting index (inclusive).
+    * @param to Ending index (exclusive).
+    * @return A VectorView over the selected range.
+    */
+    constexpr VectorView<tipodato> slice_view(const size_t from, const size_t to) const noexcept {
+        return subvectorVista(from, to);
+    }
+    /**
+    * @brief Creates a read-only view over the whole vector (O(1)).
+    */
+    constexpr VectorView<tipodato> view() const noexcept {
+        return vista();
+    }
+    /**
+    * @brief Copies the elements into a std::array<tipodato, N> (size must be N).
+    */
+    template<size_t N>
+    constexpr std::array<tipodato, N> to_array() const {
+        return aArreglo<N>();
+    }
+    /**
+    * @brief Appends n uninitialized elements (trivial types only) and returns a pointer to the first.
+    */
+    constexpr tipodato* append_uninitialized(size_t n)
+        requires std::is_trivially_copyable_v<tipodato> && std::is_trivially_default_constructible_v<tipodato> {
+        return agregarSinInicializar(n);
+    }
+    /**
+    * @brief Appends an input range (e.g. a coroutine generator) in batches written directly into the tail.
+    */
+    template <std::ranges::input_range R>
+    constexpr size_t append_from(R&& source, size_t batch = 1024) {
+        return agregarDesde(std::forward<R>(source), batch);
+    }
+    /**
+    * @brief Parses numbers separated by `delimiter` or newlines with std::from_chars, reserving once.
+    */
+    static Vector parse(std::string_view text, char delimiter = ',')
+        requires cppvector_simd::es_aritmetico_v<tipodato> {
+        return analizar(text, delimiter);
+    }
+    /**
+    * @brief Parses a file in 1 MiB blocks; errors report the byte position and line.
+    */
+    static Vector parse_file(const std::string &path, char delimiter = ',')
+        requires cppvector_simd::es_aritmetico_v<tipodato> {
+        return analizarArchivo(path, delimiter);
+    }
+    static Vector parse_file(std::FILE *file, char delimiter = ',')
+        requires cppvector_simd::es_aritmetico_v<tipodato> {
+        return analizarArchivo(file, delimiter);
+    }
+    /**
+    * @brief Converts the elements to text with std::to_chars, handing each 16 KiB block to `function`.
+    */
+    template<typename Function>
+    void format_chunks(Function &&function, const cppvector_formato::Formato &format = {}) const
+        requires cppvector_formato::formateable_v<tipodato> {
+        formatearPorBloques(std::forward<Function>(function), format);
+    }
+    template<std::output_iterator<char> It>
+    It format_to(It out, const cppvector_formato::Formato &format = {}) const
+        requires cppvector_formato::formateable_v<tipodato> {
+        return formatearEn(out, format);
+    }
+    std::string to_string(const cppvector_formato::Formato &format = {}) const
+        requires cppvector_formato::formateable_v<tipodato> {
+        return aTexto(format);
+    }
+    void write_to(std::FILE *file, const cppvector_formato::Formato &format = {}) const
+        requires cppvector_formato::formateable_v<tipodato> {
+        escribirEn(file, format);
+    }
+    void write_to(std::ostream &os, const cppvector_formato::Formato &format = {}) const
+        requires cppvector_formato::formateable_v<tipodato> {
+        escribirEn(os, format);
+    }
+    /**
     * @brief Sorts the elements in ascending order using std::sort.
     */
-    void sort() {
+    constexpr void sort() {
         ordenar();
     }
     /**
+    * @brief Sorts the elements with the given execution policy (seq, par or par_unseq).
+    */
+    template<cppvector_paralelo::PoliticaEjecucion Policy>
+    void sort(Policy policy) {
+        ordenar(policy);
+    }
+    /**
     * @brief Sorts the elements using bubble sort (not recommended for large vectors).
     */
-    void bubble_sort() {
+    constexpr void bubble_sort() {
         ordenarBurbuja();
     }
 
-    void grow_to_fit(const size_t newSize) {
+    constexpr void grow_to_fit(const size_t newSize) {
         aumentarCapacidad(newSize);
     }
 
     template <std::ranges::input_range R>
-    void append_range(R&& range) {
+    constexpr void append_range(R&& range) {
         agregarRango(std::forward<R>(range));
     }
 
     template <std::ranges::input_range R>
-    Iterator insert_range(size_t pos, R&& range) {
+    constexpr Iterator insert_range(size_t pos, R&& range) {
         return insertarRango(pos, std::forward<R>(range));
     }
 
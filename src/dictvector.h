@@ -0,0 +1,492 @@
+/**
+ * @file dictvector.h
+ * @brief Vector codificado con diccionario para columnas de baja cardinalidad
+ *
+ * DictVector guarda cada valor distinto una sola vez en un diccionario y, por cada
+ * elemento, solo un codigo entero pequeño (el indice del valor en el diccionario). Una
+ * columna de millones de cadenas tomadas de unos pocos miles de valores distintos ocupa
+ * entonces 2-4 bytes por elemento mas el diccionario.
+ *
+ * Las consultas por valor (`contiene`, `contar`, `buscar`) traducen el valor a su codigo
+ * con una tabla hash y luego recorren los codigos con los kernels SIMD de cppvector_simd,
+ * sin comparar un solo valor. `ordenar` ordena el diccionario y reubica los codigos con
+ * un counting sort.
+ *
+ * @include unordered_map
+ * @include cppvector.h
+ *
+ * @author Marian
+ * @date May 31st, 2025
+ *
+ **/
+
+#ifndef DICTVECTOR_H
+#define DICTVECTOR_H
+
+#include <unordered_map>
+#include "cppvector.h"
+
+/**
+* @struct DictVector
+* @brief Vector de valores codificados como indices de un diccionario.
+*
+* @tparam tipodato Tipo de dato almacenado (requiere std::hash y operator==)
+* @tparam tipocodigo Entero sin signo usado como codigo; limita la cantidad de valores distintos
+*/
+template<typename tipodato, typename tipocodigo = uint32_t>
+struct DictVector {
+    static_assert(std::is_unsigned_v<tipocodigo> && !std::is_same_v<tipocodigo, bool>,
+                  "tipocodigo debe ser un entero sin signo");
+
+private:
+    Vector<tipodato> diccionario_;                          /// < Valor de cada codigo
+    std::unordered_map<tipodato, tipocodigo> indices_;      /// < Codigo de cada valor
+    Vector<tipocodigo> codigos_;                            /// < Codigo de cada elemento
+    bool diccionarioOrdenado_;                              /// < true si el orden de los codigos es el de los valores
+    bool ordenado_;                                         /// < true si los elementos estan en orden ascendente
+
+    /// < Indica si tipodato admite operator< para ordenar
+    static constexpr bool comparable_ = requires (const tipodato &a, const tipodato &b) { a < b; };
+
+public:
+    DictVector() : diccionarioOrdenado_(true), ordenado_(true) {}
+
+    /**
+     * @brief Constructor para la initializer list
+     * @param lista
+     */
+    DictVector(std::initializer_list<tipodato> lista) : DictVector() {
+        codigos_.reservar(lista.size());
+        for (const tipodato &dato : lista) {
+            agregarFinal(dato);
+        }
+    }
+
+    /**
+     * @brief Codifica los elementos de un Vector.
+     * @param v
+     */
+    explicit DictVector(const Vector<tipodato> &v) : DictVector() {
+        codigos_.reservar(v.obtenerTamano());
+        for (const tipodato &dato : v) {
+            agregarFinal(dato);
+        }
+    }
+
+    //
+    //  LECTURA
+    //
+
+    /**
+    * @brief Accede a un valor por índice (no verificado).
+    * @param indice Índice del valor.
+    * @return Referencia constante al valor dentro del diccionario.
+    */
+    const tipodato &operator[](size_t indice) const {
+        return diccionario_[codigos_[indice]];
+    }
+
+    /**
+     * @brief Devuelve el valor ubicado en un índice específico.
+     * @param indice Índice del valor.
+     * @return Referencia constante al valor dentro del diccionario.
+     * @throws std::out_of_range si el índice es inválido.
+     */
+    const tipodato &en(size_t indice) const {
+        return diccionario_[codigos_.en(indice)];
+    }
+
+    [[nodiscard]] size_t obtenerTamano() const noexcept {
+        return codigos_.obtenerTamano();
+    }
+
+    [[nodiscard]] bool vacio() const noexcept {
+        return codigos_.vacio();
+    }
+
+    [[nodiscard]] bool estaOrdenado() const noexcept {
+        return ordenado_;
+    }
+
+    /**
+     * @brief Cantidad de valores distintos guardados en el diccionario.
+     */
+    [[nodiscard]] size_t cardinalidad() const noexcept {
+        return diccionario_.obtenerTamano();
+    }
+
+    /**
+     * @brief Diccionario: el valor de cada codigo.
+     */
+    const Vector<tipodato> &diccionario() const noexcept {
+        return diccionario_;
+    }
+
+    /**
+     * @brief Codigos de los elementos, en orden.
+     */
+    const Vector<tipocodigo> &codigos() const noexcept {
+        return codigos_;
+    }
+
+    //
+    //  BUSQUEDA
+    //
+
+    /**
+    * @brief Verifica si el vector contiene un valor.
+    * @param dato Valor a buscar.
+    * @return true si se encuentra el valor.
+    */
+    bool contiene(const tipodato &dato) const {
+        return buscar(dato) != -1;
+    }
+
+    /**
+    * @brief Busca la primera aparición de un valor: un acceso a la tabla hash y un recorrido SIMD de codigos.
+    * @param dato Valor a buscar.
+    * @return Índice del valor si se encuentra, -1 en caso contrario.
+    */
+    int buscar(const tipodato &dato) const {
+        const auto it = indices_.find(dato);
+        if (it == indices_.end()) return -1;
+        const tipocodigo codigo = it->second;
+        const tipocodigo *datos = codigos_.data();
+        const size_t n = codigos_.obtenerTamano();
+        if (ordenado_ && diccionarioOrdenado_) {
+            const tipocodigo *pos = std::lower_bound(datos, datos + n, codigo);
+            return pos != datos + n && *pos == codigo ? static_cast<int>(pos - datos) : -1;
+        }
+        for (size_t i = cppvector_simd::buscar(datos, n, codigo); i < n; ++i) {
+            if (datos[i] == codigo) {
+                return static_cast<int>(i);
+            }
+        }
+        return -1;
+    }
+
+    /**
+    * @brief Cuenta cuántas veces aparece un valor recorriendo los codigos con SIMD.
+    * @param dato Valor a contar.
+    * @return Número de apariciones del valor.
+    */
+    size_t contar(const tipodato &dato) const {
+        const auto it = indices_.find(dato);
+        if (it == indices_.end()) return 0;
+        const tipocodigo codigo = it->second;
+        const tipocodigo *datos = codigos_.data();
+        const size_t n = codigos_.obtenerTamano();
+        if (ordenado_ && diccionarioOrdenado_) {
+            const auto rango = std::equal_range(datos, datos + n, codigo);
+            return static_cast<size_t>(rango.second - rango.first);
+        }
+        size_t cuenta = 0;
+        for (size_t i = cppvector_simd::contar(datos, n, codigo, cuenta); i < n; ++i) {
+            if (datos[i] == codigo) {
+                ++cuenta;
+            }
+        }
+        return cuenta;
+    }
+
+    //
+    //  MODIFICADORES
+    //
+
+    /**
+     * @brief Agrega un valor al final, incorporándolo al diccionario si es nuevo.
+     * @param dato Valor a agregar.
+     * @throws std::length_error si el diccionario ya usa todos los codigos posibles.
+     */
+    void agregarFinal(const tipodato &dato) {
+        const tipocodigo codigo = codificar(dato);
+        if constexpr (comparable_) {
+            if (ordenado_ && !codigos_.vacio() && dato < diccionario_[codigos_.atras()]) {
+                ordenado_ = false;
+            }
+        } else {
+            ordenado_ = false;
+        }
+        codigos_.agregarFinal(codigo);
+    }
+
+    /**
+     * @brief Reemplaza el valor en un índice.
+     * @throws std::out_of_range si el índice es inválido.
+     * @throws std::length_error si el diccionario ya usa todos los codigos posibles.
+     */
+    void asignar(size_t indice, const tipodato &dato) {
+        if (indice >= codigos_.obtenerTamano()) {
+            throw std::out_of_range("Indice fuera de rango");
+        }
+        codigos_[indice] = codificar(dato);
+        if (codigos_.obtenerTamano() > 1) {
+            ordenado_ = false;
+        }
+    }
+
+    /**
+     * @brief Elimina el último elemento (su valor permanece en el diccionario).
+     * @throws std::out_of_range si el vector está vacío.
+     */
+    void eliminarFinal() {
+        codigos_.eliminarFinal();
+        if (codigos_.obtenerTamano() <= 1) {
+            ordenado_ = true;
+        }
+    }
+
+    /**
+     * @brief Vacía el vector y el diccionario.
+     */
+    void vaciar() {
+        diccionario_.vaciar();
+        indices_.clear();
+        codigos_.vaciar();
+        diccionarioOrdenado_ = true;
+        ordenado_ = true;
+    }
+
+    /**
+    * @brief Ordena el vector ordenando solo el diccionario.
+    *
+    * Ordena los k valores distintos, renumera los codigos para que su orden sea el de los
+    * valores y reescribe los n codigos con un counting sort: O(k log k + n).
+    */
+    void ordenar() {
+        static_assert(comparable_, "ordenar requiere operator<");
+        const size_t k = diccionario_.obtenerTamano();
+        if (!diccionarioOrdenado_) {
+            Vector<tipocodigo> orden;
+            orden.reservar(k);
+            for (size_t j = 0; j < k; ++j) {
+                orden.agregarFinal(static_cast<tipocodigo>(j));
+            }
+            std::sort(orden.begin(), orden.end(), [this](tipocodigo a, tipocodigo b) {
+                return diccionario_[a] < diccionario_[b];
+            });
+
+            Vector<tipocodigo> renumerar(k, tipocodigo(0));
+            Vector<tipodato> nuevo;
+            nuevo.reservar(k);
+            for (size_t j = 0; j < k; ++j) {
+                renumerar[orden[j]] = static_cast<tipocodigo>(j);
+                nuevo.agregarFinal(std::move(diccionario_[orden[j]]));
+            }
+            diccionario_ = std::move(nuevo);
+            for (size_t j = 0; j < k; ++j) {
+                indices_[diccionario_[j]] = static_cast<tipocodigo>(j);
+            }
+            for (tipocodigo &codigo : codigos_) {
+                codigo = renumerar[codigo];
+            }
+            diccionarioOrdenado_ = true;
+        }
+
+        if (!ordenado_) {
+            Vector<size_t> cuentas(k, 0);
+            for (tipocodigo codigo : codigos_) {
+                ++cuentas[codigo];
+            }
+            tipocodigo *salida = codigos_.data();
+            for (size_t j = 0; j < k; ++j) {
+                salida = std::fill_n(salida, cuentas[j], static_cast<tipocodigo>(j));
+            }
+            ordenado_ = true;
+        }
+    }
+
+    /**
+    * @brief Elimina los duplicados: queda cada valor distinto una vez, en orden ascendente.
+    */
+    void eliminarDuplicados() {
+        ordenar();
+        codigos_.erase(std::unique(codigos_.begin(), codigos_.end()), codigos_.end());
+    }
+
+    /**
+     * @brief Decodifica todos los elementos en un Vector, reservando una sola vez.
+     * @return Vector con los valores en orden.
+     */
+    Vector<tipodato> aVector() const {
+        Vector<tipodato> resultado;
+        resultado.reservar(codigos_.obtenerTamano());
+        for (tipocodigo codigo : codigos_) {
+            resultado.agregarFinal(diccionario_[codigo]);
+        }
+        return resultado;
+    }
+
+    bool operator==(const DictVector &otro) const {
+        if (obtenerTamano() != otro.obtenerTamano()) return false;
+        for (size_t i = 0; i < obtenerTamano(); ++i) {
+            if (!((*this)[i] == otro[i])) return false;
+        }
+        return true;
+    }
+
+    bool operator!=(const DictVector &otro) const {
+        return !(*this == otro);
+    }
+
+    /**
+    * @brief Operador de salida.
+    * @param os Flujo de salida.
+    * @param v Vector a imprimir.
+    * @return Referencia al flujo de salida.
+    */
+    friend std::ostream &operator<<(std::ostream &os, const DictVector &v) {
+        os << "[";
+        for (size_t i = 0; i < v.obtenerTamano(); i++) {
+            if (i > 0) os << ", ";
+            os << v[i];
+        }
+        os << "]";
+        return os;
+    }
+
+    //
+    //  ITERADORES
+    //
+
+    /**
+     * @struct ConstIterator
+     * @brief Iterador constante de acceso aleatorio que decodifica cada codigo al desreferenciar.
+     */
+    struct ConstIterator {
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = tipodato;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const tipodato*;
+        using reference = const tipodato&;
+
+        const tipodato *diccionario = nullptr;  /// < Valores del diccionario
+        const tipocodigo *codigo = nullptr;     /// < Codigo actual
+
+        ConstIterator() = default;
+        ConstIterator(const tipodato *d, const tipocodigo *c) : diccionario(d), codigo(c) {}
+
+        const tipodato &operator*() const { return diccionario[*codigo]; }
+        const tipodato *operator->() const { return &diccionario[*codigo]; }
+        const tipodato &operator[](std::ptrdiff_t n) const { return diccionario[codigo[n]]; }
+
+        ConstIterator &operator++() { ++codigo; return *this; }
+        ConstIterator operator++(int) { ConstIterator aux = *this; ++codigo; return aux; }
+        ConstIterator &operator--() { --codigo; return *this; }
+        ConstIterator operator--(int) { ConstIterator aux = *this; --codigo; return aux; }
+
+        ConstIterator &operator+=(std::ptrdiff_t n) { codigo += n; return *this; }
+        ConstIterator &operator-=(std::ptrdiff_t n) { codigo -= n; return *this; }
+        ConstIterator operator+(std::ptrdiff_t n) const { return ConstIterator(diccionario, codigo + n); }
+        ConstIterator operator-(std::ptrdiff_t n) const { return ConstIterator(diccionario, codigo - n); }
+        difference_type operator-(const ConstIterator &o) const { return codigo - o.codigo; }
+        friend ConstIterator operator+(std::ptrdiff_t n, const ConstIterator &it) { return it + n; }
+
+        bool operator==(const ConstIterator &o) const { return codigo == o.codigo; }
+        bool operator!=(const ConstIterator &o) const { return codigo != o.codigo; }
+        bool operator<(const ConstIterator &o) const { return codigo < o.codigo; }
+        bool operator>(const ConstIterator &o) const { return codigo > o.codigo; }
+        bool operator<=(const ConstIterator &o) const { return codigo <= o.codigo; }
+        bool operator>=(const ConstIterator &o) const { return codigo >= o.codigo; }
+    };
+
+    ConstIterator begin() const { return ConstIterator(diccionario_.data(), codigos_.data()); }
+    ConstIterator end() const { return ConstIterator(diccionario_.data(), codigos_.data() + codigos_.obtenerTamano()); }
+    ConstIterator cbegin() const { return begin(); }
+    ConstIterator cend() const { return end(); }
+
+    static_assert(std::random_access_iterator<ConstIterator>);
+
+    /** @name Métodos compatibles con std::vector
+    *Métodos alternativos con nombres en inglés para facilitar la interoperabilidad.
+    */
+    ///@{
+
+    const tipodato &at(size_t index) const {
+        return en(index);
+    }
+    [[nodiscard]] size_t size() const noexcept {
+        return obtenerTamano();
+    }
+    [[nodiscard]] bool empty() const noexcept {
+        return vacio();
+    }
+    [[nodiscard]] bool isSorted() const noexcept {
+        return estaOrdenado();
+    }
+    /**
+    * @brief Number of distinct values stored in the dictionary.
+    */
+    [[nodiscard]] size_t cardinality() const noexcept {
+        return cardinalidad();
+    }
+    const Vector<tipodato> &dictionary() const noexcept {
+        return diccionario();
+    }
+    const Vector<tipocodigo> &codes() const noexcept {
+        return codigos();
+    }
+    bool contains(const tipodato &value) const {
+        return contiene(value);
+    }
+    int find(const tipodato &value) const {
+        return buscar(value);
+    }
+    size_t count(const tipodato &value) const {
+        return contar(value);
+    }
+    void push_back(const tipodato &value) {
+        agregarFinal(value);
+    }
+    void set(size_t index, const tipodato &value) {
+        asignar(index, value);
+    }
+    void pop_back() {
+        eliminarFinal();
+    }
+    void clear() {
+        vaciar();
+    }
+    void sort() {
+        ordenar();
+    }
+    void remove_duplicates() {
+        eliminarDuplicados();
+    }
+    /**
+    * @brief Decodes every element into a contiguous Vector.
+    */
+    Vector<tipodato> to_vector() const {
+        return aVector();
+    }
+
+    ///@}
+
+private:
+    /**
+     * @brief Devuelve el codigo de un valor, agregándolo al diccionario si es nuevo.
+     */
+    tipocodigo codificar(const tipodato &dato) {
+        const auto it = indices_.find(dato);
+        if (it != indices_.end()) {
+            return it->second;
+        }
+        const size_t k = diccionario_.obtenerTamano();
+        if (k > std::numeric_limits<tipocodigo>::max()) {
+            throw std::length_error("Diccionario lleno: se agotaron los codigos");
+        }
+        const auto codigo = static_cast<tipocodigo>(k);
+        if constexpr (comparable_) {
+            if (diccionarioOrdenado_ && k > 0 && dato < diccionario_.atras()) {
+                diccionarioOrdenado_ = false;
+            }
+        } else {
+            diccionarioOrdenado_ = false;
+        }
+        diccionario_.agregarFinal(dato);
+        indices_.emplace(dato, codigo);
+        return codigo;
+    }
+};
+
+#endif //DICTVECTOR_H
@@ -0,0 +1,495 @@
+/**
+ * @file inplacevector.h
+ * @brief Vector de capacidad fija con almacenamiento dentro del propio objeto (sin heap)
+ *
+ * InplaceVector<T, N> sigue la semantica de std::inplace_vector (C++26): guarda hasta N
+ * elementos en un arreglo interno, nunca reserva memoria dinamica y es trivialmente copiable
+ * cuando T lo es. Ofrece la misma API bilingüe que Vector, incluyendo `ordenar`, `contiene`
+ * y `eliminarDuplicados`.
+ *
+ * Agregar por encima de la capacidad lanza std::bad_alloc; `intentarAgregarFinal`
+ * (try_push_back) informa el desborde devolviendo nullptr sin lanzar excepciones.
+ *
+ * @include cppvector.h
+ *
+ * @author Marian
+ * @date May 31st, 2025
+ *
+ **/
+
+#ifndef INPLACEVECTOR_H
+#define INPLACEVECTOR_H
+
+#include <new>
+#include "cppvector.h"
+
+/**
+* @struct InplaceVector
+* @brief Vector de capacidad fija N, almacenado dentro del objeto.
+*
+* @tparam tipodato Tipo de dato almacenado
+* @tparam N Capacidad maxima
+*/
+template<typename tipodato, size_t N>
+struct InplaceVector {
+private:
+    alignas(tipodato) unsigned char almacen_[N == 0 ? 1 : N * sizeof(tipodato)];  /// < Espacio para N elementos
+    size_t tamano_;                                                                 /// < Cantidad actual de elementos
+
+    tipodato *ptr(size_t i) noexcept {
+        return std::launder(reinterpret_cast<tipodato *>(almacen_)) + i;
+    }
+
+    const tipodato *ptr(size_t i) const noexcept {
+        return std::launder(reinterpret_cast<const tipodato *>(almacen_)) + i;
+    }
+
+public:
+    using value_type = tipodato;
+    using size_type = size_t;
+    using reference = tipodato&;
+    using const_reference = const tipodato&;
+    using Iterator = tipodato*;
+    using ConstIterator = const tipodato*;
+    using ReverseIterator = std::reverse_iterator<Iterator>;
+    using ConstReverseIterator = std::reverse_iterator<ConstIterator>;
+
+    InplaceVector() noexcept : tamano_(0) {}
+
+    /**
+     * @brief Constructor para la initializer list
+     * @param lista
+     * @throws std::bad_alloc si la lista tiene más de N elementos.
+     */
+    InplaceVector(std::initializer_list<tipodato> lista) : tamano_(0) {
+        if (lista.size() > N) throw std::bad_alloc();
+        for (const tipodato &dato : lista) {
+            ::new (static_cast<void *>(ptr(tamano_))) tipodato(dato);
+            ++tamano_;
+        }
+    }
+
+    /**
+     * @brief Constructor que admite un tamaño y valor inicial.
+     * @param cantidad
+     * @param valor
+     * @throws std::bad_alloc si cantidad > N.
+     */
+    explicit InplaceVector(size_t cantidad, const tipodato &valor = tipodato()) : tamano_(0) {
+        redimensionar(cantidad, valor);
+    }
+
+    // Para tipos trivialmente copiables, copiar y destruir son triviales (memcpy del objeto)
+
+    InplaceVector(const InplaceVector &) requires std::is_trivially_copy_constructible_v<tipodato> = default;
+    InplaceVector(InplaceVector &&) requires std::is_trivially_move_constructible_v<tipodato> = default;
+    InplaceVector &operator=(const InplaceVector &) requires std::is_trivially_copyable_v<tipodato> = default;
+    InplaceVector &operator=(InplaceVector &&) requires std::is_trivially_copyable_v<tipodato> = default;
+    ~InplaceVector() requires std::is_trivially_destructible_v<tipodato> = default;
+
+    InplaceVector(const InplaceVector &otro) : tamano_(0) {
+        for (const tipodato &dato : otro) {
+            ::new (static_cast<void *>(ptr(tamano_))) tipodato(dato);
+            ++tamano_;
+        }
+    }
+
+    InplaceVector(InplaceVector &&otro) noexcept(std::is_nothrow_move_constructible_v<tipodato>) : tamano_(0) {
+        for (tipodato &dato : otro) {
+            ::new (static_cast<void *>(ptr(tamano_))) tipodato(std::move(dato));
+            ++tamano_;
+        }
+        otro.vaciar();
+    }
+
+    InplaceVector &operator=(const InplaceVector &otro) {
+        if (this != &otro) {
+            vaciar();
+            for (const tipodato &dato : otro) {
+                ::new (static_cast<void *>(ptr(tamano_))) tipodato(dato);
+                ++tamano_;
+            }
+        }
+        return *this;
+    }
+
+    InplaceVector &operator=(InplaceVector &&otro) noexcept(std::is_nothrow_move_constructible_v<tipodato>) {
+        if (this != &otro) {
+            vaciar();
+            for (tipodato &dato : otro) {
+                ::new (static_cast<void *>(ptr(tamano_))) tipodato(std::move(dato));
+                ++tamano_;
+            }
+            otro.vaciar();
+        }
+        return *this;
+    }
+
+    ~InplaceVector() {
+        vaciar();
+    }
+
+    //
+    //  ITERADORES
+    //
+
+    Iterator begin() noexcept { return ptr(0); }
+    Iterator end() noexcept { return ptr(tamano_); }
+    ConstIterator begin() const noexcept { return ptr(0); }
+    ConstIterator end() const noexcept { return ptr(tamano_); }
+    ConstIterator cbegin() const noexcept { return begin(); }
+    ConstIterator cend() const noexcept { return end(); }
+    ReverseIterator rbegin() noexcept { return ReverseIterator(end()); }
+    ReverseIterator rend() noexcept { return ReverseIterator(begin()); }
+    ConstReverseIterator crbegin() const noexcept { return ConstReverseIterator(end()); }
+    ConstReverseIterator crend() const noexcept { return ConstReverseIterator(begin()); }
+
+    //
+    //  ACCESO
+    //
+
+    tipodato &operator[](size_t indice) noexcept {
+        return *ptr(indice);
+    }
+
+    const tipodato &operator[](size_t indice) const noexcept {
+        return *ptr(indice);
+    }
+
+    /**
+     * @brief Devuelve el valor ubicado en un índice específico.
+     * @throws std::out_of_range si el índice es inválido.
+     */
+    tipodato &en(size_t indice) {
+        if (indice >= tamano_) throw std::out_of_range("Indice fuera de rango");
+        return *ptr(indice);
+    }
+
+    const tipodato &en(size_t indice) const {
+        if (indice >= tamano_) throw std::out_of_range("Indice fuera de rango");
+        return *ptr(indice);
+    }
+
+    /**
+     * @brief Devuelve el primer elemento.
+     * @throws std::out_of_range Si el vector está vacío.
+     */
+    tipodato &frente() {
+        if (tamano_ == 0) throw std::out_of_range("No hay elementos en el vector");
+        return *ptr(0);
+    }
+
+    const tipodato &frente() const {
+        if (tamano_ == 0) throw std::out_of_range("No hay elementos en el vector");
+        return *ptr(0);
+    }
+
+    /**
+     * @brief Devuelve el último elemento.
+     * @throws std::out_of_range Si el vector está vacío.
+     */
+    tipodato &atras() {
+        if (tamano_ == 0) throw std::out_of_range("No hay elementos en el vector");
+        return *ptr(tamano_ - 1);
+    }
+
+    const tipodato &atras() const {
+        if (tamano_ == 0) throw std::out_of_range("No hay elementos en el vector");
+        return *ptr(tamano_ - 1);
+    }
+
+    tipodato *data() noexcept { return ptr(0); }
+    const tipodato *data() const noexcept { return ptr(0); }
+
+    //
+    //  CAPACIDAD
+    //
+
+    [[nodiscard]] bool vacio() const noexcept { return tamano_ == 0; }
+    [[nodiscard]] bool estaLleno() const noexcept { return tamano_ == N; }
+    [[nodiscard]] size_t obtenerTamano() const noexcept { return tamano_; }
+    [[nodiscard]] static constexpr size_t obtenerCapacidad() noexcept { return N; }
+    [[nodiscard]] size_t capacidadLibre() const noexcept { return N - tamano_; }
+
+    /**
+     * @brief Verifica si los elementos están en orden no decreciente. O(n).
+     */
+    [[nodiscard]] bool estaOrdenado() const {
+        return std::is_sorted(begin(), end());
+    }
+
+    //
+    //  MODIFICADORES
+    //
+
+    /**
+     * @brief Construye un elemento al final sin comprobar la capacidad.
+     * @pre obtenerTamano() < N
+     */
+    template<typename... Args>
+    tipodato &agregarFinalSinVerificar(Args &&... args) {
+        tipodato *nuevo = ::new (static_cast<void *>(ptr(tamano_))) tipodato(std::forward<Args>(args)...);
+        ++tamano_;
+        return *nuevo;
+    }
+
+    /**
+     * @brief Intenta construir un elemento al final.
+     * @return Puntero al elemento agregado, o nullptr si el vector está lleno (sin lanzar).
+     */
+    template<typename... Args>
+    tipodato *intentarEmplazarFinal(Args &&... args) {
+        if (tamano_ == N) return nullptr;
+        return &agregarFinalSinVerificar(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Intenta agregar un valor al final.
+     * @return Puntero al elemento agregado, o nullptr si el vector está lleno (sin lanzar).
+     */
+    tipodato *intentarAgregarFinal(const tipodato &dato) {
+        return intentarEmplazarFinal(dato);
+    }
+
+    tipodato *intentarAgregarFinal(tipodato &&dato) {
+        return intentarEmplazarFinal(std::move(dato));
+    }
+
+    /**
+     * @brief Construye un elemento al final.
+     * @throws std::bad_alloc si el vector está lleno.
+     */
+    template<typename... Args>
+    tipodato &emplace_back(Args &&... args) {
+        if (tamano_ == N) throw std::bad_alloc();
+        return agregarFinalSinVerificar(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Agrega un valor al final.
+     * @throws std::bad_alloc si el vector está lleno.
+     */
+    void agregarFinal(const tipodato &dato) {
+        emplace_back(dato);
+    }
+
+    void agregarFinal(tipodato &&dato) {
+        emplace_back(std::move(dato));
+    }
+
+    /**
+     * @brief Elimina el último elemento.
+     * @throws std::out_of_range si el vector está vacío.
+     */
+    void eliminarFinal() {
+        if (tamano_ == 0) throw std::out_of_range("No hay elementos en el vector");
+        --tamano_;
+        std::destroy_at(ptr(tamano_));
+    }
+
+    /**
+     * @brief Inserta un valor en un índice, desplazando los siguientes.
+     * @throws std::out_of_range si el índice es inválido.
+     * @throws std::bad_alloc si el vector está lleno.
+     */
+    void insertar(size_t indice, const tipodato &dato) {
+        if (indice > tamano_) throw std::out_of_range("Indice fuera de rango");
+        if (tamano_ == N) throw std::bad_alloc();
+        tipodato copia(dato);
+        agregarFinalSinVerificar(std::move(copia));
+        std::rotate(ptr(indice), ptr(tamano_ - 1), ptr(tamano_));
+    }
+
+    /**
+     * @brief Elimina el elemento ubicado en un índice.
+     * @throws std::out_of_range si el índice es inválido.
+     */
+    void eliminar(size_t indice) {
+        if (indice >= tamano_) throw std::out_of_range("Indice fuera de rango");
+        std::move(ptr(indice + 1), ptr(tamano_), ptr(indice));
+        eliminarFinal();
+    }
+
+    /**
+     * @brief Redimensiona el vector.
+     * @throws std::bad_alloc si nuevoTam > N.
+     */
+    void redimensionar(size_t nuevoTam, const tipodato &dato = tipodato()) {
+        if (nuevoTam > N) throw std::bad_alloc();
+        while (tamano_ > nuevoTam) {
+            eliminarFinal();
+        }
+        while (tamano_ < nuevoTam) {
+            agregarFinalSinVerificar(dato);
+        }
+    }
+
+    /**
+     * @brief Destruye todos los elementos.
+     */
+    void vaciar() noexcept {
+        std::destroy(begin(), end());
+        tamano_ = 0;
+    }
+
+    void intercambiar(InplaceVector &otro) {
+        InplaceVector aux(std::move(otro));
+        otro = std::move(*this);
+        *this = std::move(aux);
+    }
+
+    //
+    //  METODOS PERSONALIZADOS
+    //
+
+    bool contiene(const tipodato &dato) const {
+        return buscar(dato) != -1;
+    }
+
+    /**
+    * @brief Busca un valor.
+    * @return Índice del valor si se encuentra, -1 en caso contrario.
+    */
+    int buscar(const tipodato &dato) const {
+        for (size_t i = 0; i < tamano_; i++) {
+            if ((*this)[i] == dato) {
+                return static_cast<int>(i);
+            }
+        }
+        return -1;
+    }
+
+    size_t contar(const tipodato &dato) const {
+        return static_cast<size_t>(std::count(begin(), end(), dato));
+    }
+
+    /**
+    * @brief Ordena el vector usando std::sort.
+    */
+    void ordenar() {
+        std::sort(begin(), end());
+    }
+
+    /**
+    * @brief Elimina todos los elementos duplicados (el resultado queda ordenado).
+    */
+    void eliminarDuplicados() {
+        if (!estaOrdenado()) {
+            ordenar();
+        }
+        const size_t unicos = static_cast<size_t>(std::unique(begin(), end()) - begin());
+        while (tamano_ > unicos) {
+            eliminarFinal();
+        }
+    }
+
+    void invertir() {
+        std::reverse(begin(), end());
+    }
+
+    void reemplazar(const tipodato &dato, const tipodato &nuevo) {
+        std::replace(begin(), end(), dato, nuevo);
+    }
+
+    /**
+    * @brief Intercambia los elementos en los índices dados.
+    * @throws std::out_of_range Si alguno de los índices es inválido.
+    */
+    void intercambiarIndices(size_t i, size_t j) {
+        if (i >= tamano_ || j >= tamano_) throw std::out_of_range("Indice fuera de rango");
+        using std::swap;
+        swap((*this)[i], (*this)[j]);
+    }
+
+    /**
+     * @brief Copia los elementos en un Vector.
+     */
+    Vector<tipodato> aVector() const {
+        Vector<tipodato> resultado;
+        resultado.reservar(tamano_);
+        for (const tipodato &dato : *this) {
+            resultado.agregarFinal(dato);
+        }
+        return resultado;
+    }
+
+    void mostrar() const {
+        for (size_t i = 0; i < tamano_; i++) {
+            std::cout << (*this)[i];
+            if (i + 1 != tamano_) {
+                std::cout << " - ";
+            }
+        }
+        std::cout << "\n";
+    }
+
+    bool operator==(const InplaceVector &otro) const {
+        if (tamano_ != otro.tamano_) return false;
+        for (size_t i = 0; i < tamano_; ++i) {
+            if (!areEqual((*this)[i], otro[i])) return false;
+        }
+        return true;
+    }
+
+    bool operator!=(const InplaceVector &otro) const {
+        return !(*this == otro);
+    }
+
+    friend std::ostream &operator<<(std::ostream &os, const InplaceVector &v) {
+        os << "[";
+        for (size_t i = 0; i < v.tamano_; i++) {
+            if (i > 0) os << ", ";
+            os << v[i];
+        }
+        os << "]";
+        return os;
+    }
+
+    /** @name Métodos compatibles con std::vector
+    *Métodos alternativos con nombres en inglés para facilitar la interoperabilidad.
+    */
+    ///@{
+    tipodato &at(size_t index) { return en(index); }
+    const tipodato &at(size_t index) const { return en(index); }
+    tipodato &front() { return frente(); }
+    const tipodato &front() const { return frente(); }
+    tipodato &back() { return atras(); }
+    const tipodato &back() const { return atras(); }
+    [[nodiscard]] bool empty() const noexcept { return vacio(); }
+    [[nodiscard]] bool full() const noexcept { return estaLleno(); }
+    [[nodiscard]] size_t size() const noexcept { return obtenerTamano(); }
+    [[nodiscard]] static constexpr size_t capacity() noexcept { return N; }
+    [[nodiscard]] static constexpr size_t max_size() noexcept { return N; }
+    [[nodiscard]] bool isSorted() const { return estaOrdenado(); }
+    void push_back(const tipodato &value) { agregarFinal(value); }
+    void push_back(tipodato &&value) { agregarFinal(std::move(value)); }
+    /**
+    * @brief Appends `value` unless full; returns a pointer to it, or nullptr on overflow.
+    */
+    tipodato *try_push_back(const tipodato &value) { return intentarAgregarFinal(value); }
+    tipodato *try_push_back(tipodato &&value) { return intentarAgregarFinal(std::move(value)); }
+    template<typename... Args>
+    tipodato *try_emplace_back(Args &&... args) { return intentarEmplazarFinal(std::forward<Args>(args)...); }
+    template<typename... Args>
+    tipodato &unchecked_emplace_back(Args &&... args) { return agregarFinalSinVerificar(std::forward<Args>(args)...); }
+    tipodato &unchecked_push_back(const tipodato &value) { return agregarFinalSinVerificar(value); }
+    void pop_back() { eliminarFinal(); }
+    void insert(size_t index, const tipodato &value) { insertar(index, value); }
+    void erase(size_t index) { eliminar(index); }
+    void resize(size_t newSize, const tipodato &value = tipodato()) { redimensionar(newSize, value); }
+    void clear() noexcept { vaciar(); }
+    void swap(InplaceVector &other) { intercambiar(other); }
+    bool contains(const tipodato &value) const { return contiene(value); }
+    int find(const tipodato &value) const { return buscar(value); }
+    size_t count(const tipodato &value) const { return contar(value); }
+    void sort() { ordenar(); }
+    void remove_duplicates() { eliminarDuplicados(); }
+    void reverse() { invertir(); }
+    void replace_all(const tipodato &oldValue, const tipodato &newValue) { reemplazar(oldValue, newValue); }
+    void swap_indices(size_t indexA, size_t indexB) { intercambiarIndices(indexA, indexB); }
+    Vector<tipodato> to_vector() const { return aVector(); }
+    void display() const { mostrar(); }
+    ///@}
+};
+
+#endif //INPLACEVECTOR_H
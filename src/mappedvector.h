@@ -0,0 +1,303 @@
+/**
+ * @file mappedvector.h
+ * @brief Vista de solo lectura sobre un Vector serializado y proyectado en memoria con mmap
+ *
+ * MappedVectorView abre un archivo escrito por `cppvector_serial::guardar` (serialization.h),
+ * valida su cabecera y proyecta el archivo en memoria: los elementos se leen directamente de
+ * la proyeccion, sin cargarlos ni copiarlos. Abrir el archivo es O(1) y las paginas se leen
+ * del disco bajo demanda; varios procesos que abren el mismo archivo comparten esas paginas
+ * en la cache del sistema.
+ *
+ * Expone la API de consulta de VectorView (`operator[]`, iteradores, `contiene`, `buscar`,
+ * `contar`...), que usa busqueda binaria si el Vector estaba ordenado al guardarse.
+ *
+ * Solo para tipos trivialmente copiables y sistemas POSIX.
+ *
+ * @include fcntl.h
+ * @include sys/mman.h
+ * @include sys/stat.h
+ * @include unistd.h
+ * @include string
+ * @include system_error
+ * @include serialization.h
+ *
+ * @author Marian
+ * @date May 31st, 2025
+ *
+ **/
+
+#ifndef MAPPEDVECTOR_H
+#define MAPPEDVECTOR_H
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <string>
+#include <system_error>
+#include "serialization.h"
+
+/**
+* @struct MappedVectorView
+* @brief Vector de solo lectura respaldado por un archivo proyectado en memoria.
+*
+* @warning Las vistas, referencias e iteradores obtenidos dejan de ser válidos al destruir el
+*          MappedVectorView. El archivo no debe truncarse mientras está proyectado.
+*
+* @tparam tipodato Tipo de dato almacenado (trivialmente copiable)
+*/
+template<typename tipodato>
+struct MappedVectorView {
+    static_assert(std::is_trivially_copyable_v<tipodato>, "MappedVectorView requiere un tipo trivialmente copiable");
+    static_assert(alignof(tipodato) <= sizeof(cppvector_serial::Cabecera), "Los datos empiezan a 64 bytes del inicio del archivo");
+
+    /**
+    * @brief Patrón de acceso esperado, comunicado al sistema con madvise.
+    */
+    enum class Acceso {
+        NORMAL,         /// < Sin indicacion
+        SECUENCIAL,     /// < Recorridos de principio a fin: lectura anticipada agresiva
+        ALEATORIO,      /// < Busquedas puntuales: sin lectura anticipada
+    };
+
+    using ConstIterator = typename VectorView<tipodato>::ConstIterator;
+
+private:
+    void *base_ = nullptr;          /// < Inicio de la proyeccion (la cabecera)
+    size_t longitud_ = 0;           /// < Bytes proyectados
+    VectorView<tipodato> vista_;    /// < Elementos, a continuacion de la cabecera
+
+public:
+    /**
+    * @brief Proyecta el archivo `ruta` en memoria y valida su cabecera.
+    *
+    * @param ruta Archivo escrito con cppvector_serial::guardar para Vector<tipodato>.
+    * @param acceso Patrón de acceso esperado.
+    * @throws std::system_error si el archivo no puede abrirse o proyectarse.
+    * @throws std::runtime_error si la cabecera no describe un Vector<tipodato> o el archivo está truncado.
+    */
+    explicit MappedVectorView(const std::string &ruta, Acceso acceso = Acceso::NORMAL) {
+        const int fd = ::open(ruta.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) throw std::system_error(errno, std::generic_category(), "No se pudo abrir " + ruta);
+        struct stat info;
+        if (::fstat(fd, &info) != 0) {
+            const int error = errno;
+            ::close(fd);
+            throw std::system_error(error, std::generic_category(), "No se pudo leer el tamaño de " + ruta);
+        }
+        longitud_ = static_cast<size_t>(info.st_size);
+        if (longitud_ < sizeof(cppvector_serial::Cabecera)) {
+            ::close(fd);
+            throw std::runtime_error("Datos serializados truncados");
+        }
+        base_ = ::mmap(nullptr, longitud_, PROT_READ, MAP_SHARED, fd, 0);
+        const int error = errno;
+        // La proyeccion sigue siendo valida despues de cerrar el descriptor
+        ::close(fd);
+        if (base_ == MAP_FAILED) {
+            base_ = nullptr;
+            throw std::system_error(error, std::generic_category(), "No se pudo proyectar " + ruta);
+        }
+
+        try {
+            cppvector_serial::Cabecera cabecera;
+            std::memcpy(&cabecera, base_, sizeof(cabecera));
+            cppvector_serial::validarCabecera<tipodato>(cabecera, false);
+            if (cabecera.bytesDatos > longitud_ - sizeof(cabecera)) {
+                throw std::runtime_error("Datos serializados truncados");
+            }
+            const auto *datos = reinterpret_cast<const tipodato *>(static_cast<const unsigned char *>(base_) + sizeof(cabecera));
+            vista_ = VectorView<tipodato>(datos, cabecera.cantidad, (cabecera.banderas & cppvector_serial::ORDENADO) != 0);
+        } catch (...) {
+            liberar();
+            throw;
+        }
+        aconsejar(acceso);
+    }
+
+    MappedVectorView(MappedVectorView &&otro) noexcept
+        : base_(std::exchange(otro.base_, nullptr)), longitud_(std::exchange(otro.longitud_, 0)),
+          vista_(std::exchange(otro.vista_, VectorView<tipodato>())) {}
+
+    MappedVectorView &operator=(MappedVectorView &&otro) noexcept {
+        if (this != &otro) {
+            liberar();
+            base_ = std::exchange(otro.base_, nullptr);
+            longitud_ = std::exchange(otro.longitud_, 0);
+            vista_ = std::exchange(otro.vista_, VectorView<tipodato>());
+        }
+        return *this;
+    }
+
+    MappedVectorView(const MappedVectorView &) = delete;
+    MappedVectorView &operator=(const MappedVectorView &) = delete;
+
+    ~MappedVectorView() {
+        liberar();
+    }
+
+    //
+    //  PROYECCION
+    //
+
+    /**
+    * @brief Indica al sistema el patrón de acceso (madvise); solo afecta al rendimiento.
+    */
+    void aconsejar(Acceso acceso) const noexcept {
+        if (!base_) return;
+        int consejo = MADV_NORMAL;
+        if (acceso == Acceso::SECUENCIAL) consejo = MADV_SEQUENTIAL;
+        if (acceso == Acceso::ALEATORIO) consejo = MADV_RANDOM;
+        ::madvise(base_, longitud_, consejo);
+    }
+
+    /**
+    * @brief Pide al sistema que empiece a leer todo el archivo en segundo plano (MADV_WILLNEED).
+    */
+    void precargar() const noexcept {
+        if (base_) ::madvise(base_, longitud_, MADV_WILLNEED);
+    }
+
+    //
+    //  CONSULTA
+    //
+
+    /**
+    * @brief Vista sobre todos los elementos (válida mientras viva este objeto).
+    */
+    [[nodiscard]] VectorView<tipodato> vista() const noexcept {
+        return vista_;
+    }
+
+    const tipodato &operator[](size_t indice) const noexcept {
+        return vista_[indice];
+    }
+
+    /**
+    * @throws std::out_of_range si el índice es inválido.
+    */
+    const tipodato &en(size_t indice) const {
+        return vista_.en(indice);
+    }
+
+    const tipodato &frente() const {
+        if (vista_.vacio()) throw std::out_of_range("No hay elementos en el vector");
+        return vista_[0];
+    }
+
+    const tipodato &atras() const {
+        if (vista_.vacio()) throw std::out_of_range("No hay elementos en el vector");
+        return vista_[vista_.obtenerTamano() - 1];
+    }
+
+    ConstIterator begin() const noexcept { return vista_.begin(); }
+    ConstIterator end() const noexcept { return vista_.end(); }
+    ConstIterator cbegin() const noexcept { return vista_.begin(); }
+    ConstIterator cend() const noexcept { return vista_.end(); }
+
+    const tipodato *data() const noexcept {
+        return vista_.data();
+    }
+
+    [[nodiscard]] size_t obtenerTamano() const noexcept {
+        return vista_.obtenerTamano();
+    }
+
+    [[nodiscard]] bool vacio() const noexcept {
+        return vista_.vacio();
+    }
+
+    /**
+    * @brief Indica si el Vector estaba ordenado al guardarse.
+    */
+    [[nodiscard]] bool estaOrdenado() const noexcept {
+        return vista_.estaOrdenado();
+    }
+
+    /**
+    * @brief Busca un dato; con búsqueda binaria si el Vector estaba ordenado.
+    */
+    bool contiene(const tipodato &dato) const {
+        return vista_.contiene(dato);
+    }
+
+    /**
+    * @brief Índice de la primera aparición de un dato, o -1 si no está.
+    */
+    int buscar(const tipodato &dato) const {
+        return vista_.buscar(dato);
+    }
+
+    size_t contar(const tipodato &dato) const {
+        return vista_.contar(dato);
+    }
+
+    /**
+    * @brief Copia los elementos a un Vector en memoria.
+    */
+    Vector<tipodato> aVector() const {
+        return Vector<tipodato>(vista_);
+    }
+
+    /** @name Métodos compatibles con std::vector
+    *Métodos alternativos con nombres en inglés para facilitar la interoperabilidad.
+    */
+    ///@{
+
+    using Advice = Acceso;
+
+    /**
+    * @brief Passes an access-pattern hint (NORMAL, SECUENCIAL, ALEATORIO) to madvise.
+    */
+    void advise(Acceso access) const noexcept {
+        aconsejar(access);
+    }
+    void prefetch() const noexcept {
+        precargar();
+    }
+    [[nodiscard]] VectorView<tipodato> view() const noexcept {
+        return vista();
+    }
+    const tipodato &at(size_t index) const {
+        return en(index);
+    }
+    const tipodato &front() const {
+        return frente();
+    }
+    const tipodato &back() const {
+        return atras();
+    }
+    [[nodiscard]] size_t size() const noexcept {
+        return obtenerTamano();
+    }
+    [[nodiscard]] bool empty() const noexcept {
+        return vacio();
+    }
+    [[nodiscard]] bool isSorted() const noexcept {
+        return estaOrdenado();
+    }
+    bool contains(const tipodato &value) const {
+        return contiene(value);
+    }
+    int find(const tipodato &value) const {
+        return buscar(value);
+    }
+    size_t count(const tipodato &value) const {
+        return contar(value);
+    }
+    Vector<tipodato> to_vector() const {
+        return aVector();
+    }
+
+    ///@}
+
+private:
+    void liberar() noexcept {
+        if (base_) ::munmap(base_, longitud_);
+        base_ = nullptr;
+        longitud_ = 0;
+        vista_ = VectorView<tipodato>();
+    }
+};
+
+#endif //MAPPEDVECTOR_H
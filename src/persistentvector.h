@@ -0,0 +1,818 @@
+/**
+ * @file persistentvector.h
+ * @brief Vector persistente inmutable (arbol RRB) con comparticion estructural
+ *
+ * PersistentVector es un vector inmutable: cada operacion que "modifica" el contenido
+ * (`asignar`, `agregarFinal`, `concatenar`, `subvector`) devuelve una nueva version en
+ * O(log32 n) que comparte con la original todos los nodos que no cambiaron. Guardar cien
+ * versiones de una secuencia cuesta una copia mas los nodos modificados en cada una.
+ *
+ * La estructura es un arbol RRB (relaxed radix balanced): todos los nodos tienen hasta 32
+ * ranuras, las hojas estan a la misma profundidad y los nodos internos guardan los tamaños
+ * acumulados de sus hijos, lo que permite concatenar y recortar sin reconstruir el arbol.
+ *
+ * @include memory
+ * @include cppvector.h
+ *
+ * @author Marian
+ * @date May 31st, 2025
+ *
+ **/
+
+#ifndef PERSISTENTVECTOR_H
+#define PERSISTENTVECTOR_H
+
+#include <memory>
+#include "cppvector.h"
+
+/**
+* @struct PersistentVector
+* @brief Vector persistente inmutable basado en un arbol RRB.
+*
+* Las versiones se pueden compartir entre hilos sin sincronizacion adicional: los nodos
+* son inmutables y su liberacion usa contadores atomicos (std::shared_ptr).
+*
+* Para construir muchas versiones intermedias de golpe se usa `transitorio()`, que acumula
+* los cambios y produce la version final con una sola concatenacion.
+*
+* @tparam tipodato Tipo de dato almacenado
+*/
+template<typename tipodato>
+struct PersistentVector {
+private:
+    static constexpr size_t bits_ = 5;                      /// < Bits de indice por nivel
+    static constexpr size_t rama_ = size_t(1) << bits_;     /// < Ranuras por nodo (32)
+    static constexpr size_t extras_ = 2;                    /// < Nodos extra tolerados al rebalancear
+
+    struct Nodo;
+    using NodoPtr = std::shared_ptr<const Nodo>;
+
+    /**
+     * @brief Nodo del arbol. Las hojas guardan elementos; los internos, hijos y tamaños acumulados.
+     */
+    struct Nodo {
+        bool hoja = true;
+        Vector<tipodato> elementos;     /// < Elementos (solo hojas)
+        Vector<NodoPtr> hijos;          /// < Hijos (solo internos)
+        Vector<size_t> tamanos;         /// < tamanos[j] = elementos en hijos[0..j]
+
+        [[nodiscard]] size_t tamano() const {
+            return hoja ? elementos.obtenerTamano() : tamanos.atras();
+        }
+
+        [[nodiscard]] size_t ranuras() const {
+            return hoja ? elementos.obtenerTamano() : hijos.obtenerTamano();
+        }
+    };
+
+    NodoPtr raiz_;          /// < Raiz (nullptr si esta vacio)
+    size_t altura_;         /// < Altura de la raiz (0 = hoja)
+    size_t tamano_;         /// < Cantidad de elementos
+
+    PersistentVector(NodoPtr raiz, size_t altura, size_t tamano)
+        : raiz_(std::move(raiz)), altura_(altura), tamano_(tamano) {
+        // Una raiz interna con un unico hijo no aporta nada
+        while (altura_ > 0 && raiz_->hijos.obtenerTamano() == 1) {
+            NodoPtr hijo = raiz_->hijos[0];
+            raiz_ = std::move(hijo);
+            --altura_;
+        }
+    }
+
+public:
+    using value_type = tipodato;
+    using const_reference = const tipodato&;
+
+    PersistentVector() noexcept : raiz_(nullptr), altura_(0), tamano_(0) {}
+
+    /**
+     * @brief Constructor para la initializer list
+     * @param lista
+     */
+    PersistentVector(std::initializer_list<tipodato> lista) : PersistentVector(construir(lista.begin(), lista.size())) {}
+
+    /**
+     * @brief Construye una version copiando los elementos de un Vector en O(n).
+     * @param v
+     */
+    explicit PersistentVector(const Vector<tipodato> &v) : PersistentVector(construir(v.data(), v.obtenerTamano())) {}
+
+    /**
+     * @brief Construye una version moviendo los elementos de un Vector en O(n).
+     * @param v
+     */
+    explicit PersistentVector(Vector<tipodato> &&v) : PersistentVector(construir(std::make_move_iterator(v.data()), v.obtenerTamano())) {
+        v.vaciar();
+    }
+
+    //
+    //  LECTURA
+    //
+
+    /**
+    * @brief Accede a un valor por índice (no verificado). O(log32 n).
+    * @param indice Índice del valor.
+    * @return Referencia constante al valor.
+    */
+    const tipodato &operator[](size_t indice) const {
+        const Nodo *nodo = raiz_.get();
+        for (size_t h = altura_; h > 0; --h) {
+            nodo = nodo->hijos[localizar(*nodo, h, indice)].get();
+        }
+        return nodo->elementos[indice];
+    }
+
+    /**
+     * @brief Devuelve el valor ubicado en un índice específico.
+     * @param indice Índice del valor.
+     * @return Referencia constante al valor.
+     * @throws std::out_of_range si el índice es inválido.
+     */
+    const tipodato &en(size_t indice) const {
+        if (indice >= tamano_) {
+            throw std::out_of_range("Indice fuera de rango");
+        }
+        return (*this)[indice];
+    }
+
+    /**
+    * @brief Devuelve el tamaño de esta version.
+    * @return Cantidad de elementos.
+    */
+    [[nodiscard]] size_t obtenerTamano() const noexcept {
+        return tamano_;
+    }
+
+    /**
+     * @brief Verifica si la version está vacía.
+     * @return true si el tamaño es 0.
+     */
+    [[nodiscard]] bool vacio() const noexcept {
+        return tamano_ == 0;
+    }
+
+    /**
+     * @brief Recorre las hojas en orden, entregando cada bloque contiguo sin copiarlo.
+     *
+     * @tparam F Invocable con la firma `void(const tipodato* datos, size_t cantidad)`.
+     * @param f Funcion a aplicar a cada bloque.
+     */
+    template<typename F>
+    void paraCadaBloque(F &&f) const {
+        if (raiz_) {
+            recorrerHojas(*raiz_, f);
+        }
+    }
+
+    /**
+     * @brief Copia esta version en un Vector contiguo, reservando una sola vez.
+     * @return Vector con los elementos en orden.
+     */
+    Vector<tipodato> aVector() const {
+        Vector<tipodato> resultado;
+        resultado.reservar(tamano_);
+        paraCadaBloque([&resultado](const tipodato *datos, size_t cantidad) {
+            for (size_t i = 0; i < cantidad; ++i) {
+                resultado.agregarFinal(datos[i]);
+            }
+        });
+        return resultado;
+    }
+
+    bool operator==(const PersistentVector &otro) const {
+        if (tamano_ != otro.tamano_) return false;
+        if (raiz_ == otro.raiz_) return true;
+        auto a = begin();
+        for (auto b = otro.begin(); b != otro.end(); ++a, ++b) {
+            if (!areEqual(*a, *b)) return false;
+        }
+        return true;
+    }
+
+    bool operator!=(const PersistentVector &otro) const {
+        return !(*this == otro);
+    }
+
+    /**
+    * @brief Operador de salida.
+    * @param os Flujo de salida.
+    * @param v Version a imprimir.
+    * @return Referencia al flujo de salida.
+    */
+    friend std::ostream &operator<<(std::ostream &os, const PersistentVector &v) {
+        os << "[";
+        bool primero = true;
+        v.paraCadaBloque([&](const tipodato *datos, size_t cantidad) {
+            for (size_t i = 0; i < cantidad; ++i) {
+                if (!primero) os << ", ";
+                os << datos[i];
+                primero = false;
+            }
+        });
+        os << "]";
+        return os;
+    }
+
+    //
+    //  NUEVAS VERSIONES
+    //
+
+    /**
+    * @brief Devuelve una nueva version con el elemento `indice` reemplazado. O(log32 n).
+    * @param indice Índice a modificar.
+    * @param dato Nuevo valor.
+    * @return Nueva version.
+    * @throws std::out_of_range si el índice es inválido.
+    */
+    [[nodiscard]] PersistentVector asignar(size_t indice, const tipodato &dato) const {
+        if (indice >= tamano_) {
+            throw std::out_of_range("Indice fuera de rango");
+        }
+        return PersistentVector(asignarEn(raiz_, altura_, indice, dato), altura_, tamano_);
+    }
+
+    /**
+    * @brief Devuelve una nueva version con un elemento agregado al final. O(log32 n).
+    * @param dato Valor a agregar.
+    * @return Nueva version.
+    */
+    [[nodiscard]] PersistentVector agregarFinal(const tipodato &dato) const {
+        if (!raiz_) {
+            return PersistentVector(camino(0, dato), 0, 1);
+        }
+        if (NodoPtr nueva = agregarEn(raiz_, altura_, dato)) {
+            return PersistentVector(std::move(nueva), altura_, tamano_ + 1);
+        }
+        Vector<NodoPtr> hijos;
+        hijos.push_back(raiz_);
+        hijos.push_back(camino(altura_, dato));
+        return PersistentVector(crearInterno(std::move(hijos)), altura_ + 1, tamano_ + 1);
+    }
+
+    /**
+    * @brief Devuelve la concatenacion de esta version con otra. O(log32 n).
+    * @param otro Version a agregar al final.
+    * @return Nueva version.
+    */
+    [[nodiscard]] PersistentVector concatenar(const PersistentVector &otro) const {
+        if (otro.vacio()) return *this;
+        if (vacio()) return otro;
+        NodoPtr raiz = concatenarSub(raiz_, altura_, otro.raiz_, otro.altura_);
+        return PersistentVector(std::move(raiz), std::max(altura_, otro.altura_) + 1, tamano_ + otro.tamano_);
+    }
+
+    /**
+    * @brief Devuelve la version con los elementos del rango [desde, hasta). O(log32 n).
+    * @param desde Índice de inicio (inclusive).
+    * @param hasta Índice de fin (exclusive).
+    * @return Nueva version (vacía si el rango no es válido).
+    */
+    [[nodiscard]] PersistentVector subvector(size_t desde, size_t hasta) const {
+        if (desde >= hasta || hasta > tamano_) {
+            return PersistentVector{};
+        }
+        NodoPtr raiz = tomar(raiz_, altura_, hasta);
+        raiz = descartar(raiz, altura_, desde);
+        return PersistentVector(std::move(raiz), altura_, hasta - desde);
+    }
+
+    //
+    //  ITERADORES
+    //
+
+    /**
+     * @struct ConstIterator
+     * @brief Iterador constante que recorre la version hoja por hoja.
+     *
+     * Guarda la hoja actual, de modo que avanzar cuesta O(1) salvo al cambiar de hoja.
+     */
+    struct ConstIterator {
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = tipodato;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const tipodato*;
+        using reference = const tipodato&;
+
+        const PersistentVector *vec = nullptr;  /// < Version recorrida
+        size_t indice = 0;                      /// < Posicion actual
+        const tipodato *hoja = nullptr;         /// < Elementos de la hoja actual
+        size_t inicioHoja = 0;                  /// < Indice del primer elemento de la hoja
+        size_t finHoja = 0;                     /// < Indice siguiente al ultimo de la hoja
+
+        ConstIterator() = default;
+
+        ConstIterator(const PersistentVector *v, size_t i) : vec(v), indice(i) {
+            cargarHoja();
+        }
+
+        const tipodato &operator*() const {
+            return hoja[indice - inicioHoja];
+        }
+
+        const tipodato *operator->() const {
+            return &hoja[indice - inicioHoja];
+        }
+
+        ConstIterator &operator++() {
+            if (++indice == finHoja) {
+                cargarHoja();
+            }
+            return *this;
+        }
+
+        ConstIterator operator++(int) {
+            ConstIterator aux = *this;
+            ++*this;
+            return aux;
+        }
+
+        bool operator==(const ConstIterator &o) const {
+            return indice == o.indice;
+        }
+
+        bool operator!=(const ConstIterator &o) const {
+            return indice != o.indice;
+        }
+
+    private:
+        void cargarHoja() {
+            if (vec == nullptr || indice >= vec->tamano_) return;
+            const Nodo *nodo = vec->hojaEn(indice, inicioHoja);
+            hoja = nodo->elementos.data();
+            finHoja = inicioHoja + nodo->elementos.obtenerTamano();
+        }
+    };
+
+    ConstIterator begin() const { return ConstIterator(this, 0); }
+    ConstIterator end() const { return ConstIterator(this, tamano_); }
+    ConstIterator cbegin() const { return begin(); }
+    ConstIterator cend() const { return end(); }
+
+    static_assert(std::forward_iterator<ConstIterator>);
+
+    //
+    //  TRANSITORIO
+    //
+
+    /**
+     * @struct Transient
+     * @brief Constructor de versiones que acumula cambios antes de publicar una version.
+     *
+     * Los elementos agregados se guardan en un Vector contiguo y se convierten en un
+     * subarbol de una sola vez al llamar a `persistente()`, que los concatena a la base.
+     */
+    struct Transient {
+    private:
+        PersistentVector base_;             /// < Version de partida
+        Vector<tipodato> pendientes_;       /// < Elementos agregados aun no publicados
+
+    public:
+        Transient() = default;
+        explicit Transient(PersistentVector base) : base_(std::move(base)) {}
+
+        /**
+         * @brief Agrega un valor al final en O(1) amortizado.
+         * @param dato Valor a agregar.
+         */
+        void agregarFinal(const tipodato &dato) {
+            pendientes_.push_back(dato);
+        }
+
+        /**
+         * @brief Modifica el elemento `indice`, en sitio si todavía no se publicó.
+         * @param indice Índice a modificar.
+         * @param dato Nuevo valor.
+         * @throws std::out_of_range si el índice es inválido.
+         */
+        void asignar(size_t indice, const tipodato &dato) {
+            if (indice < base_.obtenerTamano()) {
+                base_ = base_.asignar(indice, dato);
+            } else {
+                pendientes_.en(indice - base_.obtenerTamano()) = dato;
+            }
+        }
+
+        /**
+         * @brief Devuelve el elemento `indice`.
+         * @throws std::out_of_range si el índice es inválido.
+         */
+        const tipodato &en(size_t indice) const {
+            if (indice < base_.obtenerTamano()) {
+                return base_[indice];
+            }
+            return pendientes_.en(indice - base_.obtenerTamano());
+        }
+
+        [[nodiscard]] size_t obtenerTamano() const {
+            return base_.obtenerTamano() + pendientes_.obtenerTamano();
+        }
+
+        /**
+         * @brief Publica los cambios acumulados como una nueva version inmutable.
+         * @return Version resultante.
+         */
+        PersistentVector persistente() {
+            if (!pendientes_.vacio()) {
+                base_ = base_.concatenar(PersistentVector(std::move(pendientes_)));
+                pendientes_ = Vector<tipodato>();
+            }
+            return base_;
+        }
+
+        void push_back(const tipodato &value) { agregarFinal(value); }
+        void set(size_t index, const tipodato &value) { asignar(index, value); }
+        const tipodato &at(size_t index) const { return en(index); }
+        [[nodiscard]] size_t size() const { return obtenerTamano(); }
+        PersistentVector persistent() { return persistente(); }
+    };
+
+    /**
+     * @brief Crea un constructor transitorio a partir de esta version.
+     */
+    Transient transitorio() const {
+        return Transient(*this);
+    }
+
+    /** @name Métodos compatibles con std::vector
+    *Métodos alternativos con nombres en inglés para facilitar la interoperabilidad.
+    */
+    ///@{
+
+    const tipodato &at(size_t index) const {
+        return en(index);
+    }
+    [[nodiscard]] size_t size() const noexcept {
+        return obtenerTamano();
+    }
+    [[nodiscard]] bool empty() const noexcept {
+        return vacio();
+    }
+    /**
+    * @brief Returns a new version with the element at `index` replaced.
+    */
+    [[nodiscard]] PersistentVector set(size_t index, const tipodato &value) const {
+        return asignar(index, value);
+    }
+    /**
+    * @brief Returns a new version with `value` appended.
+    */
+    [[nodiscard]] PersistentVector push_back(const tipodato &value) const {
+        return agregarFinal(value);
+    }
+    /**
+    * @brief Returns the concatenation of this version and `other`.
+    */
+    [[nodiscard]] PersistentVector concat(const PersistentVector &other) const {
+        return concatenar(other);
+    }
+    /**
+    * @brief Returns the version holding the elements in [from, to).
+    */
+    [[nodiscard]] PersistentVector slice(size_t from, size_t to) const {
+        return subvector(from, to);
+    }
+    /**
+    * @brief Visits every leaf as a contiguous (pointer, count) block without copying.
+    */
+    template<typename F>
+    void for_each_chunk(F &&f) const {
+        paraCadaBloque(std::forward<F>(f));
+    }
+    /**
+    * @brief Copies this version into a contiguous Vector.
+    */
+    Vector<tipodato> to_vector() const {
+        return aVector();
+    }
+    Transient transient() const {
+        return transitorio();
+    }
+
+    ///@}
+
+private:
+    /**
+     * @brief Elige el hijo de `nodo` (altura h > 0) que contiene `indice` y lo vuelve relativo.
+     *
+     * Cada hijo guarda a lo sumo 32^h elementos, asi que `indice >> (5 * h)` es una cota
+     * inferior del hijo buscado: en un arbol denso acierta directamente.
+     */
+    static size_t localizar(const Nodo &nodo, size_t h, size_t &indice) {
+        size_t j = indice >> (bits_ * h);
+        while (nodo.tamanos[j] <= indice) {
+            ++j;
+        }
+        if (j > 0) {
+            indice -= nodo.tamanos[j - 1];
+        }
+        return j;
+    }
+
+    /**
+     * @brief Devuelve la hoja que contiene `indice` y el indice de su primer elemento.
+     */
+    const Nodo *hojaEn(size_t indice, size_t &inicio) const {
+        const Nodo *nodo = raiz_.get();
+        inicio = indice;
+        for (size_t h = altura_; h > 0; --h) {
+            nodo = nodo->hijos[localizar(*nodo, h, indice)].get();
+        }
+        inicio -= indice;
+        return nodo;
+    }
+
+    template<typename F>
+    static void recorrerHojas(const Nodo &nodo, F &f) {
+        if (nodo.hoja) {
+            f(nodo.elementos.data(), nodo.elementos.obtenerTamano());
+            return;
+        }
+        for (const NodoPtr &hijo : nodo.hijos) {
+            recorrerHojas(*hijo, f);
+        }
+    }
+
+    static NodoPtr crearHoja(Vector<tipodato> &&elementos) {
+        auto nodo = std::make_shared<Nodo>();
+        nodo->elementos = std::move(elementos);
+        return nodo;
+    }
+
+    static NodoPtr crearInterno(Vector<NodoPtr> &&hijos) {
+        auto nodo = std::make_shared<Nodo>();
+        nodo->hoja = false;
+        nodo->hijos = std::move(hijos);
+        recalcularTamanos(*nodo);
+        return nodo;
+    }
+
+    static void recalcularTamanos(Nodo &nodo) {
+        nodo.tamanos.vaciar();
+        nodo.tamanos.reservar(nodo.hijos.obtenerTamano());
+        size_t acumulado = 0;
+        for (const NodoPtr &hijo : nodo.hijos) {
+            acumulado += hijo->tamano();
+            nodo.tamanos.push_back(acumulado);
+        }
+    }
+
+    /**
+     * @brief Construye un arbol denso de abajo hacia arriba en O(n).
+     */
+    template<typename It>
+    static PersistentVector construir(It datos, size_t n) {
+        if (n == 0) {
+            return PersistentVector{};
+        }
+        Vector<NodoPtr> nivel;
+        nivel.reservar((n + rama_ - 1) / rama_);
+        for (size_t i = 0; i < n; i += rama_) {
+            Vector<tipodato> elementos;
+            const size_t fin = std::min(n, i + rama_);
+            elementos.reservar(fin - i);
+            for (size_t j = i; j < fin; ++j) {
+                elementos.emplace_back(datos[j]);
+            }
+            nivel.push_back(crearHoja(std::move(elementos)));
+        }
+
+        size_t altura = 0;
+        while (nivel.obtenerTamano() > 1) {
+            Vector<NodoPtr> superior;
+            for (size_t i = 0; i < nivel.obtenerTamano(); i += rama_) {
+                Vector<NodoPtr> hijos;
+                const size_t fin = std::min(nivel.obtenerTamano(), i + rama_);
+                for (size_t j = i; j < fin; ++j) {
+                    hijos.push_back(nivel[j]);
+                }
+                superior.push_back(crearInterno(std::move(hijos)));
+            }
+            nivel = std::move(superior);
+            ++altura;
+        }
+        return PersistentVector(nivel[0], altura, n);
+    }
+
+    /**
+     * @brief Crea un camino de altura h que termina en una hoja con un solo elemento.
+     */
+    static NodoPtr camino(size_t h, const tipodato &dato) {
+        Vector<tipodato> elementos;
+        elementos.reservar(rama_);
+        elementos.push_back(dato);
+        NodoPtr nodo = crearHoja(std::move(elementos));
+        for (; h > 0; --h) {
+            Vector<NodoPtr> hijos;
+            hijos.push_back(std::move(nodo));
+            nodo = crearInterno(std::move(hijos));
+        }
+        return nodo;
+    }
+
+    static NodoPtr asignarEn(const NodoPtr &nodo, size_t h, size_t indice, const tipodato &dato) {
+        auto copia = std::make_shared<Nodo>(*nodo);
+        if (h == 0) {
+            copia->elementos[indice] = dato;
+        } else {
+            const size_t j = localizar(*nodo, h, indice);
+            copia->hijos[j] = asignarEn(nodo->hijos[j], h - 1, indice, dato);
+        }
+        return copia;
+    }
+
+    /**
+     * @brief Agrega un elemento en el camino derecho; devuelve nullptr si el subarbol esta lleno.
+     */
+    static NodoPtr agregarEn(const NodoPtr &nodo, size_t h, const tipodato &dato) {
+        if (h == 0) {
+            if (nodo->elementos.obtenerTamano() >= rama_) return nullptr;
+            auto copia = std::make_shared<Nodo>(*nodo);
+            copia->elementos.push_back(dato);
+            return copia;
+        }
+        if (NodoPtr hijo = agregarEn(nodo->hijos.atras(), h - 1, dato)) {
+            auto copia = std::make_shared<Nodo>(*nodo);
+            copia->hijos.atras() = std::move(hijo);
+            ++copia->tamanos.atras();
+            return copia;
+        }
+        if (nodo->hijos.obtenerTamano() >= rama_) return nullptr;
+        auto copia = std::make_shared<Nodo>(*nodo);
+        copia->hijos.push_back(camino(h - 1, dato));
+        copia->tamanos.push_back(copia->tamanos.atras() + 1);
+        return copia;
+    }
+
+    /**
+     * @brief Conserva los primeros `n` elementos del subarbol (1 <= n <= tamaño).
+     */
+    static NodoPtr tomar(const NodoPtr &nodo, size_t h, size_t n) {
+        if (n == nodo->tamano()) return nodo;
+        auto copia = std::make_shared<Nodo>();
+        copia->hoja = nodo->hoja;
+        if (h == 0) {
+            copia->elementos.reservar(n);
+            for (size_t i = 0; i < n; ++i) {
+                copia->elementos.push_back(nodo->elementos[i]);
+            }
+            return copia;
+        }
+        size_t indice = n - 1;
+        const size_t j = localizar(*nodo, h, indice);
+        for (size_t k = 0; k < j; ++k) {
+            copia->hijos.push_back(nodo->hijos[k]);
+        }
+        copia->hijos.push_back(tomar(nodo->hijos[j], h - 1, indice + 1));
+        recalcularTamanos(*copia);
+        return copia;
+    }
+
+    /**
+     * @brief Descarta los primeros `n` elementos del subarbol (0 <= n < tamaño).
+     */
+    static NodoPtr descartar(const NodoPtr &nodo, size_t h, size_t n) {
+        if (n == 0) return nodo;
+        auto copia = std::make_shared<Nodo>();
+        copia->hoja = nodo->hoja;
+        if (h == 0) {
+            copia->elementos.reservar(nodo->elementos.obtenerTamano() - n);
+            for (size_t i = n; i < nodo->elementos.obtenerTamano(); ++i) {
+                copia->elementos.push_back(nodo->elementos[i]);
+            }
+            return copia;
+        }
+        size_t indice = n;
+        const size_t j = localizar(*nodo, h, indice);
+        copia->hijos.push_back(descartar(nodo->hijos[j], h - 1, indice));
+        for (size_t k = j + 1; k < nodo->hijos.obtenerTamano(); ++k) {
+            copia->hijos.push_back(nodo->hijos[k]);
+        }
+        recalcularTamanos(*copia);
+        return copia;
+    }
+
+    /**
+     * @brief Concatena dos subarboles de alturas hi y hd.
+     * @return Nodo de altura max(hi, hd) + 1 con uno a tres hijos.
+     */
+    static NodoPtr concatenarSub(const NodoPtr &izq, size_t hi, const NodoPtr &der, size_t hd) {
+        if (hi > hd) {
+            NodoPtr centro = concatenarSub(izq->hijos.atras(), hi - 1, der, hd);
+            return rebalancear(izq.get(), *centro, nullptr, hi);
+        }
+        if (hi < hd) {
+            NodoPtr centro = concatenarSub(izq, hi, der->hijos.frente(), hd - 1);
+            return rebalancear(nullptr, *centro, der.get(), hd);
+        }
+        Vector<NodoPtr> hijos;
+        if (hi == 0) {
+            if (izq->elementos.obtenerTamano() + der->elementos.obtenerTamano() <= rama_) {
+                Vector<tipodato> elementos = izq->elementos;
+                for (const tipodato &dato : der->elementos) {
+                    elementos.push_back(dato);
+                }
+                hijos.push_back(crearHoja(std::move(elementos)));
+            } else {
+                hijos.push_back(izq);
+                hijos.push_back(der);
+            }
+            return crearInterno(std::move(hijos));
+        }
+        NodoPtr centro = concatenarSub(izq->hijos.atras(), hi - 1, der->hijos.frente(), hd - 1);
+        return rebalancear(izq.get(), *centro, der.get(), hi);
+    }
+
+    /**
+     * @brief Une los hijos de `izq` (sin el ultimo), `centro` y `der` (sin el primero), todos de altura h.
+     *
+     * Redistribuye las ranuras de los nietos para que no haya mas de `extras_` nodos por
+     * encima del minimo necesario, reutilizando los nodos que no cambian.
+     *
+     * @return Nodo de altura h + 1.
+     */
+    static NodoPtr rebalancear(const Nodo *izq, const Nodo &centro, const Nodo *der, size_t h) {
+        Vector<NodoPtr> ranuras;
+        if (izq) {
+            for (size_t k = 0; k + 1 < izq->hijos.obtenerTamano(); ++k) ranuras.push_back(izq->hijos[k]);
+        }
+        for (const NodoPtr &hijo : centro.hijos) ranuras.push_back(hijo);
+        if (der) {
+            for (size_t k = 1; k < der->hijos.obtenerTamano(); ++k) ranuras.push_back(der->hijos[k]);
+        }
+
+        // Plan de concatenacion: cuantas ranuras tendra cada nodo resultante
+        Vector<size_t> cuentas;
+        size_t total = 0;
+        for (const NodoPtr &r : ranuras) {
+            cuentas.push_back(r->ranuras());
+            total += r->ranuras();
+        }
+        const size_t optimo = (total + rama_ - 1) / rama_;
+        size_t n = cuentas.obtenerTamano();
+        size_t i = 0;
+        while (n > optimo + extras_) {
+            while (cuentas[i] > rama_ - extras_ / 2) {
+                ++i;
+            }
+            size_t resto = cuentas[i];
+            do {
+                const size_t minimo = std::min(resto + cuentas[i + 1], rama_);
+                cuentas[i] = minimo;
+                resto = resto + cuentas[i + 1] - minimo;
+                ++i;
+            } while (resto > 0);
+            for (size_t j = i; j + 1 < n; ++j) {
+                cuentas[j] = cuentas[j + 1];
+            }
+            --n;
+            --i;
+        }
+
+        // Ejecucion del plan
+        Vector<NodoPtr> nuevos;
+        size_t origen = 0, desplazamiento = 0;
+        for (size_t k = 0; k < n; ++k) {
+            size_t requerido = cuentas[k];
+            if (desplazamiento == 0 && ranuras[origen]->ranuras() == requerido) {
+                nuevos.push_back(ranuras[origen++]);
+                continue;
+            }
+            auto nodo = std::make_shared<Nodo>();
+            nodo->hoja = (h == 1);
+            while (requerido > 0) {
+                const Nodo &fuente = *ranuras[origen];
+                const size_t cantidad = std::min(requerido, fuente.ranuras() - desplazamiento);
+                for (size_t t = desplazamiento; t < desplazamiento + cantidad; ++t) {
+                    if (nodo->hoja) {
+                        nodo->elementos.push_back(fuente.elementos[t]);
+                    } else {
+                        nodo->hijos.push_back(fuente.hijos[t]);
+                    }
+                }
+                requerido -= cantidad;
+                desplazamiento += cantidad;
+                if (desplazamiento == fuente.ranuras()) {
+                    ++origen;
+                    desplazamiento = 0;
+                }
+            }
+            if (!nodo->hoja) {
+                recalcularTamanos(*nodo);
+            }
+            nuevos.push_back(std::move(nodo));
+        }
+
+        Vector<NodoPtr> padres;
+        for (size_t k = 0; k < nuevos.obtenerTamano(); k += rama_) {
+            Vector<NodoPtr> hijos;
+            const size_t fin = std::min(nuevos.obtenerTamano(), k + rama_);
+            for (size_t t = k; t < fin; ++t) {
+                hijos.push_back(nuevos[t]);
+            }
+            padres.push_back(crearInterno(std::move(hijos)));
+        }
+        return crearInterno(std::move(padres));
+    }
+};
+
+#endif //PERSISTENTVECTOR_H
@@ -0,0 +1,356 @@
+/**
+ * @file publishedvector.h
+ * @brief Vector publicado con read-copy-update para datos compartidos de lectura frecuente
+ *
+ * PublishedVector mantiene un puntero atomico a una version inmutable de un Vector. Los
+ * lectores obtienen esa version con una carga atomica y la recorren sin bloqueos; los
+ * escritores construyen un Vector nuevo y lo publican reemplazando el puntero.
+ *
+ * Las versiones reemplazadas se liberan con reclamacion por epocas: cada hilo lector anuncia
+ * la epoca en la que entro en una ranura propia (en su propia linea de cache), y una version
+ * retirada en la epoca e se libera cuando ningun lector activo entro en una epoca <= e. Los
+ * lectores solo escriben en su ranura, asi que no compiten por lineas de cache compartidas.
+ *
+ * @include atomic
+ * @include memory
+ * @include mutex
+ * @include thread
+ * @include utility
+ * @include cppvector.h
+ *
+ * @author Marian
+ * @date May 31st, 2025
+ *
+ **/
+
+#ifndef PUBLISHEDVECTOR_H
+#define PUBLISHEDVECTOR_H
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include "cppvector.h"
+
+/**
+* @brief Dominio de reclamación por épocas compartido por todos los PublishedVector.
+*/
+namespace cppvector_rcu {
+
+    /**
+    * @brief Ranura de un hilo lector: la época en que entró, o 0 si no está leyendo.
+    */
+    struct alignas(64) Ranura {
+        std::atomic<uint64_t> epoca{0};
+        std::atomic<bool> ocupada{false};
+        Ranura *siguiente = nullptr;
+    };
+
+    /**
+    * @brief Época global y lista de ranuras (solo crece; las ranuras se reutilizan al salir un hilo).
+    */
+    struct Dominio {
+        alignas(64) std::atomic<uint64_t> epoca{1};
+        alignas(64) std::atomic<Ranura *> ranuras{nullptr};
+
+        ~Dominio() {
+            Ranura *r = ranuras.load(std::memory_order_acquire);
+            while (r) {
+                Ranura *siguiente = r->siguiente;
+                delete r;
+                r = siguiente;
+            }
+        }
+
+        /**
+        * @brief Toma una ranura libre o agrega una nueva a la lista.
+        */
+        Ranura *adquirir() {
+            for (Ranura *r = ranuras.load(std::memory_order_acquire); r; r = r->siguiente) {
+                bool libre = false;
+                if (!r->ocupada.load(std::memory_order_relaxed) &&
+                    r->ocupada.compare_exchange_strong(libre, true, std::memory_order_acq_rel)) {
+                    return r;
+                }
+            }
+            Ranura *nueva = new Ranura;
+            nueva->ocupada.store(true, std::memory_order_relaxed);
+            Ranura *cabeza = ranuras.load(std::memory_order_relaxed);
+            do {
+                nueva->siguiente = cabeza;
+            } while (!ranuras.compare_exchange_weak(cabeza, nueva, std::memory_order_release, std::memory_order_relaxed));
+            return nueva;
+        }
+
+        /**
+        * @brief Menor época anunciada por un lector activo (UINT64_MAX si no hay ninguno).
+        */
+        uint64_t epocaMinimaActiva() const {
+            uint64_t minima = std::numeric_limits<uint64_t>::max();
+            for (Ranura *r = ranuras.load(std::memory_order_acquire); r; r = r->siguiente) {
+                const uint64_t e = r->epoca.load(std::memory_order_seq_cst);
+                if (e != 0 && e < minima) minima = e;
+            }
+            return minima;
+        }
+    };
+
+    inline Dominio &dominio() {
+        static Dominio d;
+        return d;
+    }
+
+    /**
+    * @brief Ranura del hilo actual y profundidad de lecturas anidadas; libera la ranura al terminar el hilo.
+    */
+    struct EstadoHilo {
+        Ranura *ranura = nullptr;
+        size_t anidamiento = 0;
+
+        ~EstadoHilo() {
+            if (ranura) {
+                ranura->epoca.store(0, std::memory_order_release);
+                ranura->ocupada.store(false, std::memory_order_release);
+            }
+        }
+    };
+
+    inline EstadoHilo &estadoHilo() {
+        thread_local EstadoHilo estado;
+        return estado;
+    }
+
+    /**
+    * @brief Entra en una sección de lectura anunciando la época actual.
+    */
+    inline void entrar() {
+        EstadoHilo &estado = estadoHilo();
+        if (estado.anidamiento++ > 0) return;
+        if (!estado.ranura) estado.ranura = dominio().adquirir();
+        // seq_cst: el anuncio debe ser visible antes de leer el puntero publicado
+        estado.ranura->epoca.store(dominio().epoca.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+    }
+
+    /**
+    * @brief Sale de la sección de lectura; la ranura deja de retener versiones.
+    */
+    inline void salir() {
+        EstadoHilo &estado = estadoHilo();
+        if (--estado.anidamiento > 0) return;
+        estado.ranura->epoca.store(0, std::memory_order_release);
+    }
+}
+
+/**
+* @struct PublishedVector
+* @brief Vector inmutable publicado atómicamente; lecturas sin bloqueos y escrituras por copia.
+*
+* @warning Los Vector publicados no deben modificarse. Una `Lectura` es válida hasta su destrucción
+*          y no debe sobrevivir al PublishedVector.
+*
+* @tparam tipodato Tipo de dato almacenado
+*/
+template<typename tipodato>
+struct PublishedVector {
+private:
+    /**
+    * @brief Versión reemplazada a la espera de que terminen sus lectores.
+    */
+    struct Retirada {
+        const Vector<tipodato> *version;
+        uint64_t epoca;
+    };
+
+    std::atomic<const Vector<tipodato> *> actual_;      /// < Version visible para los lectores
+    std::mutex mEscritura_;                             /// < Serializa a los escritores
+    Vector<Retirada> retiradas_;                        /// < Protegido por mEscritura_
+
+public:
+    /**
+    * @struct Lectura
+    * @brief Sección de lectura: mantiene viva la versión obtenida hasta su destrucción.
+    */
+    struct Lectura {
+        Lectura(const Lectura &) = delete;
+        Lectura &operator=(const Lectura &) = delete;
+
+        Lectura(Lectura &&otra) noexcept : version_(std::exchange(otra.version_, nullptr)) {}
+
+        ~Lectura() {
+            if (version_) cppvector_rcu::salir();
+        }
+
+        const Vector<tipodato> &operator*() const noexcept { return *version_; }
+        const Vector<tipodato> *operator->() const noexcept { return version_; }
+        const Vector<tipodato> *get() const noexcept { return version_; }
+
+    private:
+        friend struct PublishedVector;
+        explicit Lectura(const std::atomic<const Vector<tipodato> *> &actual) {
+            cppvector_rcu::entrar();
+            version_ = actual.load(std::memory_order_seq_cst);
+        }
+
+        const Vector<tipodato> *version_;
+    };
+
+    PublishedVector() : actual_(new Vector<tipodato>()) {}
+
+    explicit PublishedVector(Vector<tipodato> inicial) : actual_(new Vector<tipodato>(std::move(inicial))) {}
+
+    PublishedVector(const PublishedVector &) = delete;
+    PublishedVector &operator=(const PublishedVector &) = delete;
+
+    /**
+    * @brief Libera todas las versiones; no debe haber lecturas activas.
+    */
+    ~PublishedVector() {
+        for (const Retirada &r : retiradas_) {
+            delete r.version;
+        }
+        delete actual_.load(std::memory_order_acquire);
+    }
+
+    //
+    //  LECTURA
+    //
+
+    /**
+    * @brief Abre una sección de lectura sobre la versión publicada actual.
+    *
+    * Cuesta una carga atómica y un anuncio en la ranura propia del hilo; las lecturas pueden
+    * anidarse. La versión obtenida no cambia aunque se publique otra mientras dura la lectura.
+    */
+    Lectura leer() const {
+        return Lectura(actual_);
+    }
+
+    //
+    //  ESCRITURA
+    //
+
+    /**
+    * @brief Publica un Vector nuevo; los lectores que entren a partir de ahora lo verán.
+    * @param nuevo Versión a publicar.
+    */
+    void publicar(Vector<tipodato> nuevo) {
+        std::lock_guard<std::mutex> lk(mEscritura_);
+        publicarBloqueado(new Vector<tipodato>(std::move(nuevo)));
+    }
+
+    /**
+    * @brief Copia la versión actual, le aplica `funcion` y publica el resultado.
+    *
+    * Los escritores se serializan, así que dos actualizaciones concurrentes no se pisan.
+    *
+    * @param funcion Invocable con (Vector<tipodato>&) que modifica la copia.
+    */
+    template<typename Funcion>
+    void actualizar(Funcion &&funcion) {
+        std::lock_guard<std::mutex> lk(mEscritura_);
+        auto copia = std::make_unique<Vector<tipodato>>(*actual_.load(std::memory_order_acquire));
+        funcion(*copia);
+        publicarBloqueado(copia.release());
+    }
+
+    /**
+    * @brief Libera las versiones retiradas que ya no tienen lectores.
+    * @return Cantidad de versiones liberadas.
+    */
+    size_t reclamar() {
+        std::lock_guard<std::mutex> lk(mEscritura_);
+        return reclamarBloqueado();
+    }
+
+    /**
+    * @brief Espera a que todas las versiones retiradas puedan liberarse y las libera.
+    * @warning No debe llamarse desde una sección de lectura del mismo hilo.
+    */
+    void sincronizar() {
+        while (true) {
+            {
+                std::lock_guard<std::mutex> lk(mEscritura_);
+                reclamarBloqueado();
+                if (retiradas_.vacio()) return;
+            }
+            std::this_thread::yield();
+        }
+    }
+
+    /**
+    * @brief Versiones retiradas que aún esperan a sus lectores.
+    */
+    size_t versionesPendientes() {
+        std::lock_guard<std::mutex> lk(mEscritura_);
+        return retiradas_.obtenerTamano();
+    }
+
+    /** @name Métodos compatibles con std::vector
+    *Métodos alternativos con nombres en inglés para facilitar la interoperabilidad.
+    */
+    ///@{
+
+    /**
+    * @brief Opens a read section on the current snapshot (one atomic load, no locks).
+    */
+    Lectura read() const {
+        return leer();
+    }
+    void publish(Vector<tipodato> value) {
+        publicar(std::move(value));
+    }
+    /**
+    * @brief Copies the current snapshot, applies `function` to the copy and publishes it.
+    */
+    template<typename Function>
+    void update(Function &&function) {
+        actualizar(std::forward<Function>(function));
+    }
+    size_t reclaim() {
+        return reclamar();
+    }
+    void synchronize() {
+        sincronizar();
+    }
+    size_t pending_versions() {
+        return versionesPendientes();
+    }
+
+    ///@}
+
+private:
+    /**
+    * @brief Reemplaza la versión actual y retira la anterior en la época vigente (requiere mEscritura_).
+    *
+    * Los lectores que anuncien una época posterior entraron después del reemplazo y ya ven la
+    * versión nueva; la anterior solo puede estar retenida por lectores con época <= la de retiro.
+    */
+    void publicarBloqueado(const Vector<tipodato> *nueva) {
+        const Vector<tipodato> *vieja = actual_.exchange(nueva, std::memory_order_seq_cst);
+        const uint64_t epoca = cppvector_rcu::dominio().epoca.fetch_add(1, std::memory_order_seq_cst);
+        retiradas_.agregarFinal(Retirada{vieja, epoca});
+        reclamarBloqueado();
+    }
+
+    size_t reclamarBloqueado() {
+        if (retiradas_.vacio()) return 0;
+        const uint64_t minima = cppvector_rcu::dominio().epocaMinimaActiva();
+        size_t liberadas = 0;
+        size_t j = 0;
+        for (size_t i = 0; i < retiradas_.obtenerTamano(); ++i) {
+            if (retiradas_[i].epoca < minima) {
+                delete retiradas_[i].version;
+                ++liberadas;
+            } else {
+                retiradas_[j++] = retiradas_[i];
+            }
+        }
+        while (retiradas_.obtenerTamano() > j) {
+            retiradas_.eliminarFinal();
+        }
+        return liberadas;
+    }
+};
+
+#endif //PUBLISHEDVECTOR_H
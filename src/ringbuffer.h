@@ -0,0 +1,548 @@
+/**
+ * @file ringbuffer.h
+ * @brief Colas circulares acotadas sin bloqueos para pasar datos entre hilos
+ *
+ * SPSCRingBuffer conecta un unico productor con un unico consumidor: cada lado escribe solo
+ * su propio indice (en su propia linea de cache) y guarda una copia del indice del otro lado,
+ * que solo vuelve a leer cuando la copia indica que la cola esta llena o vacia.
+ *
+ * MPMCRingBuffer admite varios productores y consumidores siguiendo el diseño de D. Vyukov:
+ * cada celda lleva un numero de secuencia que indica a que vuelta de la cola pertenece, y
+ * reservar una posicion es un unico compare_exchange sobre el indice correspondiente.
+ *
+ * Ambas colas reservan su memoria con el mismo tipo de allocator que Vector y ofrecen
+ * `agregarVarios`/`extraerVarios`, que transfieren un lote entero con una sola
+ * actualizacion de los indices.
+ *
+ * @include atomic
+ * @include bit
+ * @include memory
+ * @include optional
+ * @include cppvector.h
+ *
+ * @author Marian
+ * @date May 31st, 2025
+ *
+ **/
+
+#ifndef RINGBUFFER_H
+#define RINGBUFFER_H
+
+#include <atomic>
+#include <bit>
+#include <memory>
+#include <optional>
+#include "cppvector.h"
+
+/**
+* @struct SPSCRingBuffer
+* @brief Cola circular acotada para un productor y un consumidor.
+*
+* Las operaciones de inserción solo pueden llamarse desde el hilo productor, y las de
+* extracción solo desde el hilo consumidor.
+*
+* @tparam tipodato Tipo de dato almacenado
+* @tparam Allocator Allocator usado para la memoria de la cola
+*/
+template<typename tipodato, typename Allocator = std::allocator<tipodato>>
+struct SPSCRingBuffer {
+private:
+    using Traits = std::allocator_traits<Allocator>;
+
+    Allocator alloc;
+    tipodato *datos_;
+    size_t capacidad_;      /// < Potencia de dos
+    size_t mascara_;        /// < capacidad_ - 1
+
+    alignas(64) std::atomic<size_t> cola_{0};       /// < Proxima posicion a escribir (productor)
+    size_t cabezaCache_ = 0;                        /// < Ultima cabeza vista por el productor
+    alignas(64) std::atomic<size_t> cabeza_{0};     /// < Proxima posicion a leer (consumidor)
+    size_t colaCache_ = 0;                          /// < Ultima cola vista por el consumidor
+
+public:
+    /**
+    * @param capacidad Capacidad mínima; se redondea a la siguiente potencia de dos.
+    * @throws std::invalid_argument si la capacidad es 0.
+    */
+    explicit SPSCRingBuffer(size_t capacidad, const Allocator &a = Allocator()) : alloc(a) {
+        if (capacidad == 0) throw std::invalid_argument("La capacidad debe ser mayor que 0");
+        capacidad_ = std::bit_ceil(capacidad);
+        mascara_ = capacidad_ - 1;
+        datos_ = Traits::allocate(alloc, capacidad_);
+    }
+
+    SPSCRingBuffer(const SPSCRingBuffer &) = delete;
+    SPSCRingBuffer &operator=(const SPSCRingBuffer &) = delete;
+
+    ~SPSCRingBuffer() {
+        const size_t fin = cola_.load(std::memory_order_relaxed);
+        for (size_t i = cabeza_.load(std::memory_order_relaxed); i != fin; ++i) {
+            Traits::destroy(alloc, datos_ + (i & mascara_));
+        }
+        Traits::deallocate(alloc, datos_, capacidad_);
+    }
+
+    //
+    //  PRODUCTOR
+    //
+
+    /**
+    * @brief Construye un elemento al final si hay espacio.
+    * @return false si la cola está llena.
+    */
+    template<typename... Args>
+    bool intentarConstruir(Args&&... args) {
+        const size_t cola = cola_.load(std::memory_order_relaxed);
+        if (cola - cabezaCache_ == capacidad_) {
+            cabezaCache_ = cabeza_.load(std::memory_order_acquire);
+            if (cola - cabezaCache_ == capacidad_) return false;
+        }
+        Traits::construct(alloc, datos_ + (cola & mascara_), std::forward<Args>(args)...);
+        cola_.store(cola + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool intentarAgregar(const tipodato &dato) {
+        return intentarConstruir(dato);
+    }
+
+    bool intentarAgregar(tipodato &&dato) {
+        return intentarConstruir(std::move(dato));
+    }
+
+    /**
+    * @brief Agrega hasta `n` elementos desde `primero` con una sola publicación del índice.
+    *
+    * El lote ocupa a lo sumo dos tramos contiguos del búfer; cada uno se construye con
+    * std::uninitialized_copy (memcpy para tipos triviales). Para mover en lugar de copiar,
+    * pasar std::make_move_iterator(...).
+    *
+    * @return Cantidad de elementos agregados (menor que n si la cola se llena).
+    */
+    template<typename Iterador>
+    size_t agregarVarios(Iterador primero, size_t n) {
+        const size_t cola = cola_.load(std::memory_order_relaxed);
+        if (capacidad_ - (cola - cabezaCache_) < n) {
+            cabezaCache_ = cabeza_.load(std::memory_order_acquire);
+        }
+        const size_t k = std::min(n, capacidad_ - (cola - cabezaCache_));
+        if (k == 0) return 0;
+        const size_t inicio = cola & mascara_;
+        const size_t tramo = std::min(k, capacidad_ - inicio);
+        std::uninitialized_copy_n(primero, tramo, datos_ + inicio);
+        std::uninitialized_copy_n(std::next(primero, tramo), k - tramo, datos_);
+        cola_.store(cola + k, std::memory_order_release);
+        return k;
+    }
+
+    //
+    //  CONSUMIDOR
+    //
+
+    /**
+    * @brief Extrae el primer elemento si hay alguno.
+    * @param destino Recibe el elemento (por asignación de movimiento).
+    * @return false si la cola está vacía.
+    */
+    bool intentarExtraer(tipodato &destino) {
+        const size_t cabeza = cabeza_.load(std::memory_order_relaxed);
+        if (cabeza == colaCache_) {
+            colaCache_ = cola_.load(std::memory_order_acquire);
+            if (cabeza == colaCache_) return false;
+        }
+        tipodato *celda = datos_ + (cabeza & mascara_);
+        destino = std::move(*celda);
+        Traits::destroy(alloc, celda);
+        cabeza_.store(cabeza + 1, std::memory_order_release);
+        return true;
+    }
+
+    std::optional<tipodato> intentarExtraer() {
+        const size_t cabeza = cabeza_.load(std::memory_order_relaxed);
+        if (cabeza == colaCache_) {
+            colaCache_ = cola_.load(std::memory_order_acquire);
+            if (cabeza == colaCache_) return std::nullopt;
+        }
+        tipodato *celda = datos_ + (cabeza & mascara_);
+        std::optional<tipodato> resultado(std::move(*celda));
+        Traits::destroy(alloc, celda);
+        cabeza_.store(cabeza + 1, std::memory_order_release);
+        return resultado;
+    }
+
+    /**
+    * @brief Mueve hasta `maximo` elementos al final de un Vector con una sola publicación del índice.
+    * @return Cantidad de elementos extraídos.
+    */
+    template<typename AllocVector>
+    size_t extraerVarios(Vector<tipodato, AllocVector> &destino, size_t maximo) {
+        const size_t cabeza = cabeza_.load(std::memory_order_relaxed);
+        if (colaCache_ - cabeza < maximo) {
+            colaCache_ = cola_.load(std::memory_order_acquire);
+        }
+        const size_t k = std::min(maximo, colaCache_ - cabeza);
+        if (k == 0) return 0;
+        if (destino.obtenerTamano() + k > destino.obtenerCapacidad()) {
+            // Al menos duplica: vaciar el buffer en un mismo Vector lote a lote no es cuadrático
+            destino.reservar(std::max(destino.obtenerTamano() + k, destino.obtenerCapacidad() * 2));
+        }
+        const size_t inicio = cabeza & mascara_;
+        const size_t tramo = std::min(k, capacidad_ - inicio);
+        moverTramo(destino, datos_ + inicio, tramo);
+        moverTramo(destino, datos_, k - tramo);
+        cabeza_.store(cabeza + k, std::memory_order_release);
+        return k;
+    }
+
+    //
+    //  CONSULTAS
+    //
+
+    [[nodiscard]] size_t obtenerCapacidad() const noexcept {
+        return capacidad_;
+    }
+
+    /**
+    * @brief Elementos en la cola; exacto solo si ningún lado está operando.
+    */
+    [[nodiscard]] size_t tamanoAproximado() const noexcept {
+        return cola_.load(std::memory_order_acquire) - cabeza_.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] bool vacio() const noexcept {
+        return tamanoAproximado() == 0;
+    }
+
+    /** @name Métodos compatibles con std::vector
+    *Métodos alternativos con nombres en inglés para facilitar la interoperabilidad.
+    */
+    ///@{
+
+    bool try_push(const tipodato &value) {
+        return intentarAgregar(value);
+    }
+    bool try_push(tipodato &&value) {
+        return intentarAgregar(std::move(value));
+    }
+    template<typename... Args>
+    bool try_emplace(Args&&... args) {
+        return intentarConstruir(std::forward<Args>(args)...);
+    }
+    /**
+    * @brief Pushes up to n elements starting at `first` with a single index publication.
+    */
+    template<typename Iterator>
+    size_t push_many(Iterator first, size_t n) {
+        return agregarVarios(first, n);
+    }
+    bool try_pop(tipodato &out) {
+        return intentarExtraer(out);
+    }
+    std::optional<tipodato> try_pop() {
+        return intentarExtraer();
+    }
+    /**
+    * @brief Moves up to `max` elements to the end of a Vector with a single index publication.
+    */
+    template<typename AllocVector>
+    size_t pop_many(Vector<tipodato, AllocVector> &out, size_t max) {
+        return extraerVarios(out, max);
+    }
+    [[nodiscard]] size_t capacity() const noexcept {
+        return obtenerCapacidad();
+    }
+    [[nodiscard]] size_t size_approx() const noexcept {
+        return tamanoAproximado();
+    }
+    [[nodiscard]] bool empty() const noexcept {
+        return vacio();
+    }
+
+    ///@}
+
+private:
+    template<typename AllocVector>
+    void moverTramo(Vector<tipodato, AllocVector> &destino, tipodato *desde, size_t n) {
+        if constexpr (std::is_trivially_copyable_v<tipodato> && std::is_trivially_default_constructible_v<tipodato>) {
+            if (n > 0) {
+                std::memcpy(destino.agregarSinInicializar(n), desde, n * sizeof(tipodato));
+            }
+        } else {
+            for (size_t i = 0; i < n; ++i) {
+                destino.agregarFinal(std::move(desde[i]));
+                Traits::destroy(alloc, desde + i);
+            }
+        }
+    }
+};
+
+/**
+* @struct MPMCRingBuffer
+* @brief Cola circular acotada para varios productores y varios consumidores (diseño de Vyukov).
+*
+* La celda de la posición p está libre para el productor de la vuelta actual cuando su
+* secuencia vale p, y lista para el consumidor cuando vale p + 1; al extraer se le asigna
+* p + capacidad para la vuelta siguiente.
+*
+* @tparam tipodato Tipo de dato almacenado
+* @tparam Allocator Allocator usado para la memoria de la cola
+*/
+template<typename tipodato, typename Allocator = std::allocator<tipodato>>
+struct MPMCRingBuffer {
+private:
+    struct Celda {
+        std::atomic<size_t> secuencia;
+        alignas(tipodato) unsigned char almacenamiento[sizeof(tipodato)];
+
+        tipodato *dato() noexcept { return std::launder(reinterpret_cast<tipodato *>(almacenamiento)); }
+    };
+
+    using AllocCelda = typename std::allocator_traits<Allocator>::template rebind_alloc<Celda>;
+    using Traits = std::allocator_traits<AllocCelda>;
+
+    AllocCelda alloc;
+    Celda *celdas_;
+    size_t capacidad_;      /// < Potencia de dos
+    size_t mascara_;        /// < capacidad_ - 1
+
+    alignas(64) std::atomic<size_t> cola_{0};       /// < Proxima posicion a reservar por un productor
+    alignas(64) std::atomic<size_t> cabeza_{0};     /// < Proxima posicion a reservar por un consumidor
+
+public:
+    /**
+    * @param capacidad Capacidad mínima; se redondea a la siguiente potencia de dos (al menos 2).
+    * @throws std::invalid_argument si la capacidad es 0.
+    */
+    explicit MPMCRingBuffer(size_t capacidad, const Allocator &a = Allocator()) : alloc(a) {
+        if (capacidad == 0) throw std::invalid_argument("La capacidad debe ser mayor que 0");
+        capacidad_ = std::bit_ceil(std::max<size_t>(capacidad, 2));
+        mascara_ = capacidad_ - 1;
+        celdas_ = Traits::allocate(alloc, capacidad_);
+        for (size_t i = 0; i < capacidad_; ++i) {
+            ::new (static_cast<void *>(&celdas_[i].secuencia)) std::atomic<size_t>(i);
+        }
+    }
+
+    MPMCRingBuffer(const MPMCRingBuffer &) = delete;
+    MPMCRingBuffer &operator=(const MPMCRingBuffer &) = delete;
+
+    ~MPMCRingBuffer() {
+        const size_t fin = cola_.load(std::memory_order_relaxed);
+        for (size_t i = cabeza_.load(std::memory_order_relaxed); i != fin; ++i) {
+            std::destroy_at(celdas_[i & mascara_].dato());
+        }
+        Traits::deallocate(alloc, celdas_, capacidad_);
+    }
+
+    //
+    //  PRODUCTORES
+    //
+
+    /**
+    * @brief Construye un elemento al final si hay espacio; seguro desde varios hilos.
+    * @return false si la cola está llena.
+    */
+    template<typename... Args>
+    bool intentarConstruir(Args&&... args) {
+        size_t pos = cola_.load(std::memory_order_relaxed);
+        Celda *celda;
+        while (true) {
+            celda = &celdas_[pos & mascara_];
+            const size_t secuencia = celda->secuencia.load(std::memory_order_acquire);
+            const auto diferencia = static_cast<std::ptrdiff_t>(secuencia - pos);
+            if (diferencia == 0) {
+                if (cola_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diferencia < 0) {
+                return false;
+            } else {
+                pos = cola_.load(std::memory_order_relaxed);
+            }
+        }
+        ::new (static_cast<void *>(celda->almacenamiento)) tipodato(std::forward<Args>(args)...);
+        celda->secuencia.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool intentarAgregar(const tipodato &dato) {
+        return intentarConstruir(dato);
+    }
+
+    bool intentarAgregar(tipodato &&dato) {
+        return intentarConstruir(std::move(dato));
+    }
+
+    /**
+    * @brief Agrega hasta `n` elementos reservando todas sus posiciones con un solo compare_exchange.
+    *
+    * Solo se reservan las celdas consecutivas que ya están libres, así que nunca espera a un
+    * consumidor. Para mover en lugar de copiar, pasar std::make_move_iterator(...).
+    *
+    * @return Cantidad de elementos agregados.
+    */
+    template<typename Iterador>
+    size_t agregarVarios(Iterador primero, size_t n) {
+        size_t pos = cola_.load(std::memory_order_relaxed);
+        size_t k;
+        while (true) {
+            k = 0;
+            while (k < n && k < capacidad_ &&
+                   celdas_[(pos + k) & mascara_].secuencia.load(std::memory_order_acquire) == pos + k) {
+                ++k;
+            }
+            if (k == 0) {
+                const size_t secuencia = celdas_[pos & mascara_].secuencia.load(std::memory_order_acquire);
+                if (static_cast<std::ptrdiff_t>(secuencia - pos) < 0) return 0;   // Llena
+                pos = cola_.load(std::memory_order_relaxed);                      // Otro productor avanzó
+                continue;
+            }
+            if (cola_.compare_exchange_weak(pos, pos + k, std::memory_order_relaxed)) break;
+        }
+        for (size_t i = 0; i < k; ++i, ++primero) {
+            Celda &celda = celdas_[(pos + i) & mascara_];
+            ::new (static_cast<void *>(celda.almacenamiento)) tipodato(*primero);
+            celda.secuencia.store(pos + i + 1, std::memory_order_release);
+        }
+        return k;
+    }
+
+    //
+    //  CONSUMIDORES
+    //
+
+    /**
+    * @brief Extrae el primer elemento si hay alguno; seguro desde varios hilos.
+    * @param destino Recibe el elemento (por asignación de movimiento).
+    * @return false si la cola está vacía.
+    */
+    bool intentarExtraer(tipodato &destino) {
+        size_t pos = cabeza_.load(std::memory_order_relaxed);
+        Celda *celda;
+        while (true) {
+            celda = &celdas_[pos & mascara_];
+            const size_t secuencia = celda->secuencia.load(std::memory_order_acquire);
+            const auto diferencia = static_cast<std::ptrdiff_t>(secuencia - (pos + 1));
+            if (diferencia == 0) {
+                if (cabeza_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diferencia < 0) {
+                return false;
+            } else {
+                pos = cabeza_.load(std::memory_order_relaxed);
+            }
+        }
+        destino = std::move(*celda->dato());
+        std::destroy_at(celda->dato());
+        celda->secuencia.store(pos + capacidad_, std::memory_order_release);
+        return true;
+    }
+
+    std::optional<tipodato> intentarExtraer() requires std::is_default_constructible_v<tipodato> {
+        tipodato dato;
+        if (!intentarExtraer(dato)) return std::nullopt;
+        return std::optional<tipodato>(std::move(dato));
+    }
+
+    /**
+    * @brief Mueve hasta `maximo` elementos al final de un Vector reservándolos con un solo compare_exchange.
+    * @return Cantidad de elementos extraídos.
+    */
+    template<typename AllocVector>
+    size_t extraerVarios(Vector<tipodato, AllocVector> &destino, size_t maximo) {
+        size_t pos = cabeza_.load(std::memory_order_relaxed);
+        size_t k;
+        while (true) {
+            k = 0;
+            while (k < maximo && k < capacidad_ &&
+                   celdas_[(pos + k) & mascara_].secuencia.load(std::memory_order_acquire) == pos + k + 1) {
+                ++k;
+            }
+            if (k == 0) {
+                const size_t secuencia = celdas_[pos & mascara_].secuencia.load(std::memory_order_acquire);
+                if (static_cast<std::ptrdiff_t>(secuencia - (pos + 1)) < 0) return 0;  // Vacia
+                pos = cabeza_.load(std::memory_order_relaxed);                         // Otro consumidor avanzó
+                continue;
+            }
+            if (cabeza_.compare_exchange_weak(pos, pos + k, std::memory_order_relaxed)) break;
+        }
+        if (destino.obtenerTamano() + k > destino.obtenerCapacidad()) {
+            // Al menos duplica: vaciar el buffer en un mismo Vector lote a lote no es cuadrático
+            destino.reservar(std::max(destino.obtenerTamano() + k, destino.obtenerCapacidad() * 2));
+        }
+        for (size_t i = 0; i < k; ++i) {
+            Celda &celda = celdas_[(pos + i) & mascara_];
+            destino.agregarFinal(std::move(*celda.dato()));
+            std::destroy_at(celda.dato());
+            celda.secuencia.store(pos + i + capacidad_, std::memory_order_release);
+        }
+        return k;
+    }
+
+    //
+    //  CONSULTAS
+    //
+
+    [[nodiscard]] size_t obtenerCapacidad() const noexcept {
+        return capacidad_;
+    }
+
+    /**
+    * @brief Posiciones reservadas entre productores y consumidores; aproximado con hilos activos.
+    */
+    [[nodiscard]] size_t tamanoAproximado() const noexcept {
+        const size_t cola = cola_.load(std::memory_order_acquire);
+        const size_t cabeza = cabeza_.load(std::memory_order_acquire);
+        return cola > cabeza ? cola - cabeza : 0;
+    }
+
+    [[nodiscard]] bool vacio() const noexcept {
+        return tamanoAproximado() == 0;
+    }
+
+    /** @name Métodos compatibles con std::vector
+    *Métodos alternativos con nombres en inglés para facilitar la interoperabilidad.
+    */
+    ///@{
+
+    bool try_push(const tipodato &value) {
+        return intentarAgregar(value);
+    }
+    bool try_push(tipodato &&value) {
+        return intentarAgregar(std::move(value));
+    }
+    template<typename... Args>
+    bool try_emplace(Args&&... args) {
+        return intentarConstruir(std::forward<Args>(args)...);
+    }
+    /**
+    * @brief Pushes up to n elements, claiming all their slots with a single compare-exchange.
+    */
+    template<typename Iterator>
+    size_t push_many(Iterator first, size_t n) {
+        return agregarVarios(first, n);
+    }
+    bool try_pop(tipodato &out) {
+        return intentarExtraer(out);
+    }
+    std::optional<tipodato> try_pop() requires std::is_default_constructible_v<tipodato> {
+        return intentarExtraer();
+    }
+    /**
+    * @brief Moves up to `max` elements to the end of a Vector, claiming them with a single compare-exchange.
+    */
+    template<typename AllocVector>
+    size_t pop_many(Vector<tipodato, AllocVector> &out, size_t max) {
+        return extraerVarios(out, max);
+    }
+    [[nodiscard]] size_t capacity() const noexcept {
+        return obtenerCapacidad();
+    }
+    [[nodiscard]] size_t size_approx() const noexcept {
+        return tamanoAproximado();
+    }
+    [[nodiscard]] bool empty() const noexcept {
+        return vacio();
+    }
+
+    ///@}
+};
+
+#endif //RINGBUFFER_H
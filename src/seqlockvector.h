@@ -0,0 +1,305 @@
+/**
+ * @file seqlockvector.h
+ * @brief Vector protegido con seqlock para lecturas optimistas sin bloqueos
+ *
+ * SeqlockVector tiene un unico escritor y cualquier numero de lectores. El escritor incrementa
+ * un contador de version antes y despues de cada modificacion (queda impar mientras escribe);
+ * un lector copia los datos y comprueba que la version no cambio ni era impar, y si no, lo
+ * reintenta. Los lectores nunca bloquean al escritor ni ejecutan operaciones atomicas de
+ * lectura-modificacion-escritura: solo cargas.
+ *
+ * Los elementos se publican como palabras atomicas de 64 bits leidas y escritas con orden
+ * relajado, de modo que una lectura concurrente con una escritura no es una carrera de datos;
+ * el escritor conserva ademas una copia normal en un Vector.
+ *
+ * Pensado para vectores pequeños de tipos trivialmente copiables (precios, contadores,
+ * instantaneas) que se actualizan en el lugar; el tamaño se fija al construir.
+ *
+ * @include array
+ * @include atomic
+ * @include bit
+ * @include memory
+ * @include span
+ * @include cppvector.h
+ *
+ * @author Marian
+ * @date May 31st, 2025
+ *
+ **/
+
+#ifndef SEQLOCKVECTOR_H
+#define SEQLOCKVECTOR_H
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <memory>
+#include <span>
+#include "cppvector.h"
+
+/**
+* @struct SeqlockVector
+* @brief Vector de tamaño fijo con un escritor y lectores optimistas (seqlock).
+*
+* Las operaciones de escritura (`asignar`, `reemplazar`, `actualizar`) solo pueden llamarse
+* desde un hilo a la vez; las de lectura, desde cualquier hilo en cualquier momento.
+*
+* @tparam tipodato Tipo de dato almacenado (trivialmente copiable)
+*/
+template<typename tipodato>
+struct SeqlockVector {
+    static_assert(std::is_trivially_copyable_v<tipodato>, "SeqlockVector requiere un tipo trivialmente copiable");
+
+private:
+    alignas(64) std::atomic<uint64_t> version_{0};      /// < Impar mientras el escritor modifica
+    std::unique_ptr<std::atomic<uint64_t>[]> palabras_;  /// < Bytes de los elementos, en palabras de 64 bits
+    size_t cantidadPalabras_;
+    Vector<tipodato> escritor_;                          /// < Copia del escritor, siempre igual a lo publicado
+
+public:
+    /**
+     * @brief Crea un vector de n copias de `valor`.
+     */
+    explicit SeqlockVector(size_t n, const tipodato &valor = tipodato()) : SeqlockVector(Vector<tipodato>(n, valor)) {}
+
+    /**
+     * @brief Crea un vector con el contenido (y el tamaño) de `inicial`.
+     */
+    explicit SeqlockVector(Vector<tipodato> inicial) : escritor_(std::move(inicial)) {
+        cantidadPalabras_ = (escritor_.obtenerTamano() * sizeof(tipodato) + 7) / 8;
+        palabras_ = std::make_unique<std::atomic<uint64_t>[]>(cantidadPalabras_);
+        publicarPalabras(0, cantidadPalabras_);
+    }
+
+    SeqlockVector(const SeqlockVector &) = delete;
+    SeqlockVector &operator=(const SeqlockVector &) = delete;
+
+    //
+    //  ESCRITOR
+    //
+
+    /**
+     * @brief Reemplaza el elemento en `indice`.
+     * @throws std::out_of_range si el índice es inválido.
+     */
+    void asignar(size_t indice, const tipodato &valor) {
+        if (indice >= obtenerTamano()) throw std::out_of_range("Indice fuera de rango");
+        iniciarEscritura();
+        escritor_[indice] = valor;
+        publicarElementos(indice, indice + 1);
+        terminarEscritura();
+    }
+
+    /**
+     * @brief Reemplaza todas las apariciones de un dato por otro en una sola escritura.
+     * @return Cantidad de elementos reemplazados.
+     */
+    size_t reemplazar(const tipodato &dato, const tipodato &nuevo) {
+        size_t primero = obtenerTamano(), ultimo = 0, reemplazados = 0;
+        for (size_t i = 0; i < obtenerTamano(); ++i) {
+            if (escritor_[i] == dato) {
+                primero = std::min(primero, i);
+                ultimo = i + 1;
+                ++reemplazados;
+            }
+        }
+        if (reemplazados == 0) return 0;
+        iniciarEscritura();
+        for (size_t i = primero; i < ultimo; ++i) {
+            if (escritor_[i] == dato) {
+                escritor_[i] = nuevo;
+            }
+        }
+        publicarElementos(primero, ultimo);
+        terminarEscritura();
+        return reemplazados;
+    }
+
+    /**
+     * @brief Aplica varias modificaciones como una sola escritura.
+     *
+     * Los lectores ven todos los cambios de `funcion` o ninguno.
+     *
+     * @param funcion Invocable con (std::span<tipodato>) que modifica los elementos en el lugar.
+     */
+    template<typename Funcion>
+    void actualizar(Funcion &&funcion) {
+        iniciarEscritura();
+        funcion(std::span<tipodato>(escritor_.data(), escritor_.obtenerTamano()));
+        publicarPalabras(0, cantidadPalabras_);
+        terminarEscritura();
+    }
+
+    //
+    //  LECTORES
+    //
+
+    /**
+     * @brief Lee un elemento de forma consistente, reintentando si coincide con una escritura (no verificado).
+     */
+    tipodato operator[](size_t indice) const noexcept {
+        std::array<unsigned char, sizeof(tipodato)> bytes;
+        const size_t desde = indice * sizeof(tipodato);
+        leerConsistente([&] { cargarBytes(desde, sizeof(tipodato), bytes.data()); });
+        return std::bit_cast<tipodato>(bytes);
+    }
+
+    /**
+     * @brief Lee el elemento en `indice`.
+     * @throws std::out_of_range si el índice es inválido.
+     */
+    tipodato en(size_t indice) const {
+        if (indice >= obtenerTamano()) throw std::out_of_range("Indice fuera de rango");
+        return (*this)[indice];
+    }
+
+    /**
+     * @brief Copia una instantánea consistente de todos los elementos en `destino`.
+     *
+     * Reutiliza la memoria de `destino` si alcanza, así que leer en un bucle no reserva memoria.
+     * El estado de orden de `destino` se recalcula sobre la instantánea copiada.
+     */
+    template<typename Allocator>
+    void copiarEn(Vector<tipodato, Allocator> &destino) const {
+        const size_t n = obtenerTamano();
+        destino.redimensionar(n);
+        leerConsistente([&] { cargarBytes(0, n * sizeof(tipodato), destino.data()); });
+        destino.revisarOrden();
+    }
+
+    /**
+     * @brief Devuelve una instantánea consistente como Vector.
+     */
+    Vector<tipodato> aVector() const {
+        Vector<tipodato> resultado;
+        copiarEn(resultado);
+        return resultado;
+    }
+
+    /**
+     * @brief Versión actual: par si no hay escritura en curso; aumenta en 2 con cada escritura.
+     */
+    [[nodiscard]] uint64_t version() const noexcept {
+        return version_.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] size_t obtenerTamano() const noexcept {
+        return escritor_.obtenerTamano();
+    }
+
+    [[nodiscard]] bool vacio() const noexcept {
+        return obtenerTamano() == 0;
+    }
+
+    /** @name Métodos compatibles con std::vector
+    *Métodos alternativos con nombres en inglés para facilitar la interoperabilidad.
+    */
+    ///@{
+
+    void set(size_t index, const tipodato &value) {
+        asignar(index, value);
+    }
+    size_t replace_all(const tipodato &value, const tipodato &newValue) {
+        return reemplazar(value, newValue);
+    }
+    /**
+    * @brief Applies several modifications as one write; readers see all of them or none.
+    */
+    template<typename Function>
+    void update(Function &&function) {
+        actualizar(std::forward<Function>(function));
+    }
+    tipodato at(size_t index) const {
+        return en(index);
+    }
+    template<typename Allocator>
+    void copy_to(Vector<tipodato, Allocator> &destination) const {
+        copiarEn(destination);
+    }
+    Vector<tipodato> to_vector() const {
+        return aVector();
+    }
+    [[nodiscard]] size_t size() const noexcept {
+        return obtenerTamano();
+    }
+    [[nodiscard]] bool empty() const noexcept {
+        return vacio();
+    }
+
+    ///@}
+
+private:
+    void iniciarEscritura() noexcept {
+        const uint64_t v = version_.load(std::memory_order_relaxed);
+        version_.store(v + 1, std::memory_order_relaxed);
+        // Las escrituras de datos no pueden adelantarse a la version impar
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+
+    void terminarEscritura() noexcept {
+        version_.store(version_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Repite `lectura` hasta que no coincida con una escritura.
+     */
+    template<typename Lectura>
+    void leerConsistente(Lectura &&lectura) const {
+        while (true) {
+            const uint64_t antes = version_.load(std::memory_order_acquire);
+            if (antes & 1) {
+                pausa();
+                continue;
+            }
+            lectura();
+            // Las lecturas de datos no pueden retrasarse hasta despues de releer la version
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (version_.load(std::memory_order_relaxed) == antes) return;
+        }
+    }
+
+    static void pausa() noexcept {
+#if defined(__SSE2__)
+        _mm_pause();
+#endif
+    }
+
+    /**
+     * @brief Copia `bytes` bytes publicados a partir del byte `desde`, palabra por palabra.
+     */
+    void cargarBytes(size_t desde, size_t bytes, void *destino) const noexcept {
+        unsigned char *salida = static_cast<unsigned char *>(destino);
+        size_t copiados = 0;
+        while (copiados < bytes) {
+            const size_t byte = desde + copiados;
+            const uint64_t palabra = palabras_[byte / 8].load(std::memory_order_relaxed);
+            const size_t desfase = byte % 8;
+            const size_t n = std::min(bytes - copiados, 8 - desfase);
+            std::memcpy(salida + copiados, reinterpret_cast<const unsigned char *>(&palabra) + desfase, n);
+            copiados += n;
+        }
+    }
+
+    /**
+     * @brief Publica las palabras que contienen los elementos [desde, hasta).
+     */
+    void publicarElementos(size_t desde, size_t hasta) noexcept {
+        if (desde >= hasta) return;
+        publicarPalabras(desde * sizeof(tipodato) / 8, (hasta * sizeof(tipodato) + 7) / 8);
+    }
+
+    /**
+     * @brief Copia las palabras [desde, hasta) de la copia del escritor a las palabras publicadas.
+     */
+    void publicarPalabras(size_t desde, size_t hasta) noexcept {
+        const unsigned char *bytes = reinterpret_cast<const unsigned char *>(escritor_.data());
+        const size_t total = escritor_.obtenerTamano() * sizeof(tipodato);
+        for (size_t w = desde; w < hasta; ++w) {
+            uint64_t palabra = 0;
+            std::memcpy(&palabra, bytes + w * 8, std::min<size_t>(8, total - w * 8));
+            palabras_[w].store(palabra, std::memory_order_relaxed);
+        }
+    }
+};
+
+#endif //SEQLOCKVECTOR_H
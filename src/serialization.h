@@ -0,0 +1,581 @@
+/**
+ * @file serialization.h
+ * @brief Serializacion binaria de Vector a descriptores, FILE*, flujos y memoria
+ *
+ * El formato es una cabecera fija de 64 bytes (firma, version, orden de bytes, tamaño del tipo,
+ * cantidad de elementos, bytes de datos y si el vector estaba ordenado) seguida de los datos.
+ * Para tipos trivialmente copiables los datos son los bytes de los elementos tal cual estan en
+ * memoria: se escriben con una sola llamada (writev de cabecera y datos en un descriptor) y se
+ * leen directamente sobre la memoria del Vector destino, sin conversiones. Los datos empiezan
+ * a 64 bytes del inicio, alineados para cualquier tipo basico, asi que el archivo tambien
+ * puede proyectarse en memoria y usarse sin copiarlo (ver mappedvector.h).
+ *
+ * Los demas tipos se codifican elemento a elemento con `Codec<T>`, que el usuario puede
+ * especializar; hay codecs para std::basic_string, std::pair y Vector anidados.
+ *
+ * Los archivos solo se leen en maquinas con el mismo orden de bytes con que se escribieron.
+ *
+ * @include bit
+ * @include cstdio
+ * @include istream
+ * @include ostream
+ * @include span
+ * @include string
+ * @include system_error
+ * @include utility
+ * @include sys/uio.h, unistd.h (POSIX)
+ * @include cppvector.h
+ *
+ * @author Marian
+ * @date May 31st, 2025
+ *
+ **/
+
+#ifndef SERIALIZATION_H
+#define SERIALIZATION_H
+
+#include <bit>
+#include <cerrno>
+#include <cstdio>
+#include <istream>
+#include <ostream>
+#include <span>
+#include <string>
+#include <system_error>
+#include <utility>
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/uio.h>
+#include <unistd.h>
+#define CPPVECTOR_POSIX 1
+#endif
+#include "cppvector.h"
+
+namespace cppvector_serial {
+
+    //
+    //  FORMATO
+    //
+
+    inline constexpr char firma[8] = {'C', 'P', 'P', 'V', 'E', 'C', 'T', 'R'};
+    inline constexpr uint16_t versionFormato = 1;
+
+    /// < Orden de bytes de la maquina que escribe: 1 little endian, 2 big endian
+    inline constexpr uint8_t ordenBytesNativo = std::endian::native == std::endian::little ? 1 : 2;
+
+    enum Banderas : uint8_t {
+        ORDENADO = 1,       /// < El Vector estaba ordenado (ordenado_)
+        CODIFICADO = 2,     /// < Datos escritos con Codec<T>, no como bytes crudos
+    };
+
+    /**
+    * @brief Cabecera de 64 bytes al inicio de cada Vector serializado.
+    */
+    struct Cabecera {
+        char firma[8];
+        uint16_t version;
+        uint8_t ordenBytes;
+        uint8_t banderas;
+        uint32_t tamanoTipo;        /// < sizeof(tipodato)
+        uint64_t cantidad;          /// < Cantidad de elementos
+        uint64_t bytesDatos;        /// < Bytes de datos que siguen a la cabecera
+        unsigned char reservado[32];
+    };
+    static_assert(sizeof(Cabecera) == 64 && std::is_trivially_copyable_v<Cabecera>);
+
+    /**
+    * @brief Cabecera para `cantidad` elementos de tipodato.
+    */
+    template<typename tipodato>
+    Cabecera crearCabecera(uint64_t cantidad, bool ordenado, bool codificado, uint64_t bytesDatos) {
+        Cabecera c{};
+        std::memcpy(c.firma, firma, sizeof(firma));
+        c.version = versionFormato;
+        c.ordenBytes = ordenBytesNativo;
+        c.banderas = static_cast<uint8_t>((ordenado ? ORDENADO : 0) | (codificado ? CODIFICADO : 0));
+        c.tamanoTipo = sizeof(tipodato);
+        c.cantidad = cantidad;
+        c.bytesDatos = bytesDatos;
+        return c;
+    }
+
+    /**
+    * @brief Comprueba que la cabecera describa un Vector<tipodato> legible en esta máquina.
+    *
+    * @param codificado Si se esperan datos de Codec<T> (true) o bytes crudos (false).
+    * @throws std::runtime_error si la firma, la versión, el orden de bytes, el tamaño del tipo
+    *         o la longitud de los datos no coinciden.
+    */
+    template<typename tipodato>
+    void validarCabecera(const Cabecera &c, bool codificado) {
+        if (std::memcmp(c.firma, firma, sizeof(firma)) != 0) {
+            throw std::runtime_error("Formato de Vector serializado no reconocido");
+        }
+        if (c.version != versionFormato) {
+            throw std::runtime_error("Version de formato no soportada");
+        }
+        if (c.ordenBytes != ordenBytesNativo) {
+            throw std::runtime_error("El orden de bytes del archivo no coincide con el de esta maquina");
+        }
+        if (c.tamanoTipo != sizeof(tipodato)) {
+            throw std::runtime_error("El tamaño del tipo almacenado no coincide");
+        }
+        if (((c.banderas & CODIFICADO) != 0) != codificado) {
+            throw std::runtime_error("Los datos no estan en la representacion esperada para el tipo");
+        }
+        if (!codificado && (c.cantidad > std::numeric_limits<uint64_t>::max() / sizeof(tipodato) ||
+                            c.bytesDatos != c.cantidad * sizeof(tipodato))) {
+            throw std::runtime_error("Longitud de datos invalida");
+        }
+    }
+
+    //
+    //  CODECS
+    //
+
+    /**
+    * @brief Destino de Codec<T>::codificar: agrega bytes a un Vector<unsigned char>.
+    */
+    struct Codificador {
+        Vector<unsigned char> &bytes;
+
+        void escribir(const void *datos, size_t n) {
+            if (n == 0) return;
+            std::memcpy(bytes.agregarSinInicializar(n), datos, n);
+        }
+
+        template<typename T>
+        void escribirValor(const T &valor) requires std::is_trivially_copyable_v<T> {
+            escribir(&valor, sizeof(T));
+        }
+    };
+
+    /**
+    * @brief Origen de Codec<T>::decodificar: lee bytes de un bloque de memoria.
+    */
+    struct Decodificador {
+        const unsigned char *actual;
+        const unsigned char *fin;
+
+        /**
+        * @throws std::runtime_error si quedan menos de n bytes.
+        */
+        void leer(void *destino, size_t n) {
+            if (static_cast<size_t>(fin - actual) < n) throw std::runtime_error("Datos serializados truncados");
+            if (n == 0) return;
+            std::memcpy(destino, actual, n);
+            actual += n;
+        }
+
+        template<typename T>
+        T leerValor() requires std::is_trivially_copyable_v<T> {
+            std::array<unsigned char, sizeof(T)> bytes;
+            leer(bytes.data(), sizeof(T));
+            return std::bit_cast<T>(bytes);
+        }
+    };
+
+    /**
+    * @brief Codificación de un elemento; especializar para tipos no trivialmente copiables.
+    *
+    * Una especialización define `static void codificar(Codificador &, const T &)` y
+    * `static T decodificar(Decodificador &)`.
+    */
+    template<typename T>
+    struct Codec;
+
+    template<typename T>
+    concept Codificable = requires (Codificador &salida, Decodificador &entrada, const T &valor) {
+        Codec<T>::codificar(salida, valor);
+        { Codec<T>::decodificar(entrada) } -> std::convertible_to<T>;
+    };
+
+    template<typename T> requires std::is_trivially_copyable_v<T>
+    struct Codec<T> {
+        static void codificar(Codificador &salida, const T &valor) {
+            salida.escribirValor(valor);
+        }
+        static T decodificar(Decodificador &entrada) {
+            return entrada.template leerValor<T>();
+        }
+    };
+
+    template<typename C, typename Traits, typename A>
+    struct Codec<std::basic_string<C, Traits, A>> {
+        static void codificar(Codificador &salida, const std::basic_string<C, Traits, A> &valor) {
+            salida.escribirValor<uint64_t>(valor.size());
+            salida.escribir(valor.data(), valor.size() * sizeof(C));
+        }
+        static std::basic_string<C, Traits, A> decodificar(Decodificador &entrada) {
+            const uint64_t n = entrada.leerValor<uint64_t>();
+            if (n > static_cast<size_t>(entrada.fin - entrada.actual) / sizeof(C)) {
+                throw std::runtime_error("Datos serializados truncados");
+            }
+            std::basic_string<C, Traits, A> valor(n, C());
+            entrada.leer(valor.data(), n * sizeof(C));
+            return valor;
+        }
+    };
+
+    template<typename A, typename B>
+    struct Codec<std::pair<A, B>> {
+        static void codificar(Codificador &salida, const std::pair<A, B> &valor) {
+            Codec<A>::codificar(salida, valor.first);
+            Codec<B>::codificar(salida, valor.second);
+        }
+        static std::pair<A, B> decodificar(Decodificador &entrada) {
+            A primero = Codec<A>::decodificar(entrada);
+            return std::pair<A, B>(std::move(primero), Codec<B>::decodificar(entrada));
+        }
+    };
+
+    template<typename T, typename Allocator>
+    struct Codec<Vector<T, Allocator>> {
+        static void codificar(Codificador &salida, const Vector<T, Allocator> &valor) {
+            salida.escribirValor<uint64_t>(valor.obtenerTamano());
+            for (const T &elemento : valor) {
+                Codec<T>::codificar(salida, elemento);
+            }
+        }
+        static Vector<T, Allocator> decodificar(Decodificador &entrada) {
+            const uint64_t n = entrada.leerValor<uint64_t>();
+            Vector<T, Allocator> valor;
+            // Cada elemento ocupa al menos un byte: no se reserva más de lo que queda
+            valor.reservar(std::min<uint64_t>(n, static_cast<uint64_t>(entrada.fin - entrada.actual)));
+            for (uint64_t i = 0; i < n; ++i) {
+                valor.agregarFinal(Codec<T>::decodificar(entrada));
+            }
+            return valor;
+        }
+    };
+
+    //
+    //  DESTINOS Y ORIGENES
+    //
+
+    /**
+    * @brief Estado interno de Vector que no expone la interfaz pública.
+    */
+    struct AccesoVector {
+        template<typename tipodato, typename Allocator>
+        static void fijarOrden(Vector<tipodato, Allocator> &v, bool ordenado) noexcept {
+            v.ordenado_ = ordenado;
+        }
+    };
+
+#ifdef CPPVECTOR_POSIX
+    /**
+    * @brief Escribe en un descriptor con writev, reintentando escrituras parciales.
+    */
+    struct SalidaFd {
+        int fd;
+
+        void escribir(const void *a, size_t na, const void *b, size_t nb) {
+            iovec partes[2] = {{const_cast<void *>(a), na}, {const_cast<void *>(b), nb}};
+            iovec *actual = partes;
+            int cuenta = 2;
+            while (cuenta > 0 && actual->iov_len == 0) { ++actual; --cuenta; }
+            while (cuenta > 0) {
+                const ssize_t r = ::writev(fd, actual, cuenta);
+                if (r < 0) {
+                    if (errno == EINTR) continue;
+                    throw std::system_error(errno, std::generic_category(), "Error al escribir el Vector");
+                }
+                if (r == 0) throw std::runtime_error("Error al escribir el Vector");
+                size_t escritos = static_cast<size_t>(r);
+                while (cuenta > 0 && escritos >= actual->iov_len) {
+                    escritos -= actual->iov_len;
+                    ++actual;
+                    --cuenta;
+                }
+                if (cuenta > 0) {
+                    actual->iov_base = static_cast<char *>(actual->iov_base) + escritos;
+                    actual->iov_len -= escritos;
+                }
+            }
+        }
+    };
+
+    /**
+    * @brief Lee de un descriptor, reintentando lecturas parciales.
+    */
+    struct EntradaFd {
+        int fd;
+
+        void leer(void *destino, size_t n) {
+            char *salida = static_cast<char *>(destino);
+            while (n > 0) {
+                const ssize_t r = ::read(fd, salida, n);
+                if (r < 0) {
+                    if (errno == EINTR) continue;
+                    throw std::system_error(errno, std::generic_category(), "Error al leer el Vector");
+                }
+                if (r == 0) throw std::runtime_error("Datos serializados truncados");
+                salida += r;
+                n -= static_cast<size_t>(r);
+            }
+        }
+    };
+#endif
+
+    struct SalidaArchivo {
+        std::FILE *archivo;
+
+        void escribir(const void *a, size_t na, const void *b, size_t nb) {
+            if (std::fwrite(a, 1, na, archivo) != na || (nb > 0 && std::fwrite(b, 1, nb, archivo) != nb)) {
+                throw std::runtime_error("Error al escribir el Vector");
+            }
+        }
+    };
+
+    struct EntradaArchivo {
+        std::FILE *archivo;
+
+        void leer(void *destino, size_t n) {
+            if (std::fread(destino, 1, n, archivo) != n) {
+                throw std::runtime_error(std::ferror(archivo) ? "Error al leer el Vector" : "Datos serializados truncados");
+            }
+        }
+    };
+
+    struct SalidaFlujo {
+        std::ostream &flujo;
+
+        void escribir(const void *a, size_t na, const void *b, size_t nb) {
+            flujo.write(static_cast<const char *>(a), static_cast<std::streamsize>(na));
+            if (nb > 0) flujo.write(static_cast<const char *>(b), static_cast<std::streamsize>(nb));
+            if (!flujo) throw std::runtime_error("Error al escribir el Vector");
+        }
+    };
+
+    struct EntradaFlujo {
+        std::istream &flujo;
+
+        void leer(void *destino, size_t n) {
+            flujo.read(static_cast<char *>(destino), static_cast<std::streamsize>(n));
+            if (static_cast<size_t>(flujo.gcount()) != n) throw std::runtime_error("Datos serializados truncados");
+        }
+    };
+
+    struct SalidaMemoria {
+        Vector<unsigned char> &bytes;
+
+        void escribir(const void *a, size_t na, const void *b, size_t nb) {
+            unsigned char *destino = bytes.agregarSinInicializar(na + nb);
+            std::memcpy(destino, a, na);
+            if (nb > 0) std::memcpy(destino + na, b, nb);
+        }
+    };
+
+    //
+    //  GUARDAR Y CARGAR
+    //
+
+    /**
+    * @brief Escribe cabecera y datos de `v` en `salida` con una sola llamada a `escribir`.
+    */
+    template<typename tipodato, typename Allocator, typename Salida>
+    void guardarEn(const Vector<tipodato, Allocator> &v, Salida &&salida) {
+        const size_t n = v.obtenerTamano();
+        if constexpr (std::is_trivially_copyable_v<tipodato>) {
+            const Cabecera c = crearCabecera<tipodato>(n, v.estaOrdenado(), false, n * sizeof(tipodato));
+            salida.escribir(&c, sizeof(c), v.data(), n * sizeof(tipodato));
+        } else {
+            static_assert(Codificable<tipodato>, "Especializa cppvector_serial::Codec<T> para serializar este tipo");
+            Vector<unsigned char> bytes;
+            Codificador codificador{bytes};
+            for (const tipodato &elemento : v) {
+                Codec<tipodato>::codificar(codificador, elemento);
+            }
+            const Cabecera c = crearCabecera<tipodato>(n, v.estaOrdenado(), true, bytes.obtenerTamano());
+            salida.escribir(&c, sizeof(c), bytes.data(), bytes.obtenerTamano());
+        }
+    }
+
+    /**
+    * @brief Decodifica `c.cantidad` elementos con Codec<T> y comprueba que se usen todos los bytes.
+    */
+    template<typename tipodato, typename Allocator>
+    void decodificarEn(Vector<tipodato, Allocator> &v, const Cabecera &c, Decodificador entrada) {
+        v.reservar(std::min<uint64_t>(c.cantidad, c.bytesDatos));
+        for (uint64_t i = 0; i < c.cantidad; ++i) {
+            v.agregarFinal(Codec<tipodato>::decodificar(entrada));
+        }
+        if (entrada.actual != entrada.fin) throw std::runtime_error("Longitud de datos invalida");
+    }
+
+    /**
+    * @brief Lee un Vector de `entrada`: los bytes crudos van directo a la memoria del Vector.
+    */
+    template<typename tipodato, typename Allocator, typename Entrada>
+    Vector<tipodato, Allocator> cargarDe(Entrada &&entrada) {
+        constexpr bool codificado = !std::is_trivially_copyable_v<tipodato>;
+        Cabecera c;
+        entrada.leer(&c, sizeof(c));
+        validarCabecera<tipodato>(c, codificado);
+
+        Vector<tipodato, Allocator> v;
+        if constexpr (!codificado) {
+            if constexpr (std::is_trivially_default_constructible_v<tipodato>) {
+                tipodato *destino = v.agregarSinInicializar(c.cantidad);
+                entrada.leer(destino, c.bytesDatos);
+            } else {
+                v.redimensionar(c.cantidad);
+                entrada.leer(v.data(), c.bytesDatos);
+            }
+            if constexpr (std::is_same_v<tipodato, bool>) {
+                // Un byte distinto de 0 y 1 no es un bool valido: se revisa antes de leerlo como bool
+                const auto *bytes = reinterpret_cast<const unsigned char *>(v.data());
+                if (std::any_of(bytes, bytes + c.bytesDatos, [](unsigned char b) { return b > 1; })) {
+                    throw std::runtime_error("Los datos no estan en la representacion esperada para el tipo");
+                }
+            }
+        } else {
+            static_assert(Codificable<tipodato>, "Especializa cppvector_serial::Codec<T> para serializar este tipo");
+            Vector<unsigned char> bytes;
+            entrada.leer(bytes.agregarSinInicializar(c.bytesDatos), c.bytesDatos);
+            decodificarEn(v, c, Decodificador{bytes.data(), bytes.data() + bytes.obtenerTamano()});
+        }
+        AccesoVector::fijarOrden(v, (c.banderas & ORDENADO) != 0);
+        return v;
+    }
+
+#ifdef CPPVECTOR_POSIX
+    /**
+    * @brief Guarda `v` en un descriptor abierto, desde su posición actual.
+    *
+    * Para tipos trivialmente copiables, cabecera y datos se escriben con un único writev.
+    *
+    * @throws std::system_error si falla la escritura.
+    */
+    template<typename tipodato, typename Allocator>
+    void guardar(const Vector<tipodato, Allocator> &v, int fd) {
+        guardarEn(v, SalidaFd{fd});
+    }
+
+    /**
+    * @brief Carga un Vector desde un descriptor abierto, desde su posición actual.
+    *
+    * Lee exactamente los bytes del Vector, así que pueden guardarse varios seguidos.
+    *
+    * @throws std::runtime_error si la cabecera no es válida o los datos están truncados.
+    */
+    template<typename tipodato, typename Allocator = std::allocator<tipodato>>
+    Vector<tipodato, Allocator> cargar(int fd) {
+        return cargarDe<tipodato, Allocator>(EntradaFd{fd});
+    }
+#endif
+
+    /**
+    * @brief Guarda `v` en un FILE* abierto en modo binario.
+    */
+    template<typename tipodato, typename Allocator>
+    void guardar(const Vector<tipodato, Allocator> &v, std::FILE *archivo) {
+        guardarEn(v, SalidaArchivo{archivo});
+    }
+
+    template<typename tipodato, typename Allocator = std::allocator<tipodato>>
+    Vector<tipodato, Allocator> cargar(std::FILE *archivo) {
+        return cargarDe<tipodato, Allocator>(EntradaArchivo{archivo});
+    }
+
+    /**
+    * @brief Guarda `v` en un flujo binario (std::ios::binary).
+    */
+    template<typename tipodato, typename Allocator>
+    void guardar(const Vector<tipodato, Allocator> &v, std::ostream &flujo) {
+        guardarEn(v, SalidaFlujo{flujo});
+    }
+
+    template<typename tipodato, typename Allocator = std::allocator<tipodato>>
+    Vector<tipodato, Allocator> cargar(std::istream &flujo) {
+        return cargarDe<tipodato, Allocator>(EntradaFlujo{flujo});
+    }
+
+    /**
+    * @brief Agrega la representación serializada de `v` al final de `bytes`.
+    */
+    template<typename tipodato, typename Allocator>
+    void guardar(const Vector<tipodato, Allocator> &v, Vector<unsigned char> &bytes) {
+        guardarEn(v, SalidaMemoria{bytes});
+    }
+
+    /**
+    * @brief Carga un Vector desde memoria; los datos codificados se decodifican sin copia previa.
+    * @throws std::runtime_error si la cabecera no es válida o faltan bytes.
+    */
+    template<typename tipodato, typename Allocator = std::allocator<tipodato>>
+    Vector<tipodato, Allocator> cargar(std::span<const unsigned char> bytes) {
+        Decodificador entrada{bytes.data(), bytes.data() + bytes.size()};
+        Cabecera c;
+        entrada.leer(&c, sizeof(c));
+        // Se comprueba antes de reservar, para no reservar por una cantidad corrupta
+        if (c.bytesDatos > static_cast<uint64_t>(entrada.fin - entrada.actual)) {
+            throw std::runtime_error("Datos serializados truncados");
+        }
+        if constexpr (std::is_trivially_copyable_v<tipodato>) {
+            return cargarDe<tipodato, Allocator>(Decodificador{bytes.data(), entrada.actual + c.bytesDatos});
+        } else {
+            validarCabecera<tipodato>(c, true);
+            Vector<tipodato, Allocator> v;
+            decodificarEn(v, c, Decodificador{entrada.actual, entrada.actual + c.bytesDatos});
+            AccesoVector::fijarOrden(v, (c.banderas & ORDENADO) != 0);
+            return v;
+        }
+    }
+
+    template<typename tipodato, typename Allocator = std::allocator<tipodato>>
+    Vector<tipodato, Allocator> cargar(const Vector<unsigned char> &bytes) {
+        return cargar<tipodato, Allocator>(std::span<const unsigned char>(bytes.data(), bytes.obtenerTamano()));
+    }
+
+    /** @name Nombres en inglés
+    *Alias con nombres en inglés para facilitar la interoperabilidad.
+    */
+    ///@{
+
+#ifdef CPPVECTOR_POSIX
+    /**
+    * @brief Saves `v` to an open file descriptor (one writev for trivially copyable types).
+    */
+    template<typename tipodato, typename Allocator>
+    void save(const Vector<tipodato, Allocator> &v, int fd) {
+        guardar(v, fd);
+    }
+    template<typename tipodato, typename Allocator = std::allocator<tipodato>>
+    Vector<tipodato, Allocator> load(int fd) {
+        return cargar<tipodato, Allocator>(fd);
+    }
+#endif
+    template<typename tipodato, typename Allocator>
+    void save(const Vector<tipodato, Allocator> &v, std::FILE *file) {
+        guardar(v, file);
+    }
+    template<typename tipodato, typename Allocator = std::allocator<tipodato>>
+    Vector<tipodato, Allocator> load(std::FILE *file) {
+        return cargar<tipodato, Allocator>(file);
+    }
+    template<typename tipodato, typename Allocator>
+    void save(const Vector<tipodato, Allocator> &v, std::ostream &stream) {
+        guardar(v, stream);
+    }
+    template<typename tipodato, typename Allocator = std::allocator<tipodato>>
+    Vector<tipodato, Allocator> load(std::istream &stream) {
+        return cargar<tipodato, Allocator>(stream);
+    }
+    template<typename tipodato, typename Allocator>
+    void save(const Vector<tipodato, Allocator> &v, Vector<unsigned char> &bytes) {
+        guardar(v, bytes);
+    }
+    template<typename tipodato, typename Allocator = std::allocator<tipodato>>
+    Vector<tipodato, Allocator> load(std::span<const unsigned char> bytes) {
+        return cargar<tipodato, Allocator>(bytes);
+    }
+    template<typename tipodato, typename Allocator = std::allocator<tipodato>>
+    Vector<tipodato, Allocator> load(const Vector<unsigned char> &bytes) {
+        return cargar<tipodato, Allocator>(bytes);
+    }
+
+    ///@}
+}
+
+#endif //SERIALIZATION_H
@@ -0,0 +1,323 @@
+/**
+ * @file shardedvector.h
+ * @brief Vector repartido en fragmentos por hilo con union final en una sola reserva
+ *
+ * ShardedVector da a cada hilo su propio Vector (fragmento), cada uno en su propia linea de
+ * cache, de modo que los hilos agregan elementos sin sincronizarse entre si. Al terminar,
+ * `unir` suma los tamaños de los fragmentos, reserva el Vector destino una sola vez y copia
+ * los fragmentos en paralelo; `unirOrdenado` hace en cambio una mezcla de k vias de los
+ * fragmentos ordenados.
+ *
+ * @include memory
+ * @include mutex
+ * @include queue
+ * @include thread
+ * @include unordered_map
+ * @include cppvector.h
+ *
+ * @author Marian
+ * @date May 31st, 2025
+ *
+ **/
+
+#ifndef SHARDEDVECTOR_H
+#define SHARDEDVECTOR_H
+
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <unordered_map>
+#include "cppvector.h"
+
+/**
+* @struct ShardedVector
+* @brief Vector con un fragmento por hilo que se une en un único Vector contiguo.
+*
+* Agregar elementos es seguro desde cualquier número de hilos: cada hilo escribe solo en su
+* fragmento. `obtenerTamano`, `unir`, `unirOrdenado`, `vaciar` y `paraCadaFragmento` requieren
+* que ningún hilo esté agregando.
+*
+* @tparam tipodato Tipo de dato almacenado
+*/
+template<typename tipodato>
+struct ShardedVector {
+private:
+    /**
+    * @brief Fragmento de un hilo, alineado a su propia línea de caché.
+    */
+    struct alignas(64) Fragmento {
+        Vector<tipodato> datos;
+    };
+
+    /**
+    * @brief Último fragmento usado por el hilo actual; el id evita confundir instancias.
+    */
+    struct CacheHilo {
+        uint64_t id = 0;
+        Fragmento *fragmento = nullptr;
+    };
+
+    inline static std::atomic<uint64_t> siguienteId_{1};    /// < Id de la proxima instancia
+    inline static thread_local CacheHilo cache_;            /// < Acceso rapido al fragmento propio
+
+    const uint64_t id_;                                             /// < Id de esta instancia
+    std::mutex mFragmentos_;                                        /// < Protege el registro de fragmentos
+    std::unordered_map<std::thread::id, Fragmento *> porHilo_;      /// < Fragmento de cada hilo
+    Vector<std::unique_ptr<Fragmento>> fragmentos_;                 /// < Todos los fragmentos
+
+public:
+    ShardedVector() : id_(siguienteId_.fetch_add(1, std::memory_order_relaxed)) {}
+
+    ShardedVector(const ShardedVector &) = delete;
+    ShardedVector &operator=(const ShardedVector &) = delete;
+
+    //
+    //  INSERCION POR HILO
+    //
+
+    /**
+    * @brief Fragmento del hilo actual (se crea en el primer uso).
+    *
+    * Después del primer acceso solo cuesta comparar el id guardado en una variable thread_local.
+    * Sirve para operaciones en bloque sobre el fragmento propio (reservar, agregarRango...).
+    */
+    Vector<tipodato> &fragmentoLocal() {
+        if (cache_.id != id_) {
+            cache_.fragmento = registrarHilo();
+            cache_.id = id_;
+        }
+        return cache_.fragmento->datos;
+    }
+
+    /**
+    * @brief Agrega un elemento al fragmento del hilo actual.
+    * @param dato Elemento a agregar.
+    */
+    void agregarFinal(const tipodato &dato) {
+        fragmentoLocal().agregarFinal(dato);
+    }
+
+    void agregarFinal(tipodato &&dato) {
+        fragmentoLocal().agregarFinal(std::move(dato));
+    }
+
+    template<typename... Args>
+    void emplace_back(Args&&... args) {
+        fragmentoLocal().emplace_back(std::forward<Args>(args)...);
+    }
+
+    //
+    //  OPERACIONES SIN PRODUCTORES ACTIVOS
+    //
+
+    /**
+    * @brief Suma de los tamaños de todos los fragmentos.
+    */
+    [[nodiscard]] size_t obtenerTamano() {
+        std::lock_guard<std::mutex> lk(mFragmentos_);
+        size_t total = 0;
+        for (const auto &fragmento : fragmentos_) {
+            total += fragmento->datos.obtenerTamano();
+        }
+        return total;
+    }
+
+    [[nodiscard]] bool vacio() {
+        return obtenerTamano() == 0;
+    }
+
+    [[nodiscard]] size_t cantidadFragmentos() {
+        std::lock_guard<std::mutex> lk(mFragmentos_);
+        return fragmentos_.obtenerTamano();
+    }
+
+    /**
+    * @brief Mueve todos los fragmentos, en orden de creación, a un único Vector.
+    *
+    * Reserva el resultado una sola vez. Para tipos trivialmente copiables, la copia se reparte
+    * en bloques entre los hilos del pool (un bloque puede abarcar varios fragmentos); para el
+    * resto, los elementos se mueven en secuencia. Los fragmentos quedan vacíos.
+    *
+    * @return Vector con todos los elementos.
+    */
+    Vector<tipodato> unir() {
+        std::lock_guard<std::mutex> lk(mFragmentos_);
+        const size_t k = fragmentos_.obtenerTamano();
+        Vector<size_t> inicios;
+        inicios.reservar(k + 1);
+        size_t total = 0;
+        for (const auto &fragmento : fragmentos_) {
+            inicios.agregarFinal(total);
+            total += fragmento->datos.obtenerTamano();
+        }
+        inicios.agregarFinal(total);
+
+        Vector<tipodato> resultado;
+        if constexpr (std::is_trivially_copyable_v<tipodato> && std::is_trivially_default_constructible_v<tipodato>) {
+            tipodato *destino = resultado.agregarSinInicializar(total);
+            cppvector_paralelo::paraRango(total, 0, [&](size_t desde, size_t hasta) {
+                // Último fragmento que empieza en o antes de `desde`
+                size_t f = static_cast<size_t>(std::upper_bound(inicios.begin(), inicios.end(), desde) - inicios.begin()) - 1;
+                while (desde < hasta) {
+                    const size_t fin = std::min(hasta, inicios[f + 1]);
+                    if (fin > desde) {
+                        std::memcpy(destino + desde, fragmentos_[f]->datos.data() + (desde - inicios[f]),
+                                    (fin - desde) * sizeof(tipodato));
+                    }
+                    desde = fin;
+                    ++f;
+                }
+            });
+        } else {
+            resultado.reservar(total);
+            for (auto &fragmento : fragmentos_) {
+                for (tipodato &dato : fragmento->datos) {
+                    resultado.agregarFinal(std::move(dato));
+                }
+            }
+        }
+
+        for (auto &fragmento : fragmentos_) {
+            fragmento->datos.vaciar();
+        }
+        return resultado;
+    }
+
+    /**
+    * @brief Une los fragmentos con una mezcla de k vías; el resultado queda ordenado.
+    *
+    * Los fragmentos que no estén ordenados (se comprueba recorriéndolos) se ordenan primero, en
+    * paralelo. La mezcla usa una cola de prioridad con la cabeza de cada fragmento
+    * (O(n log k)) y reserva el resultado una sola vez. Los fragmentos quedan vacíos.
+    *
+    * @return Vector ordenado con todos los elementos.
+    */
+    Vector<tipodato> unirOrdenado() {
+        std::lock_guard<std::mutex> lk(mFragmentos_);
+        const size_t k = fragmentos_.obtenerTamano();
+        cppvector_paralelo::paraRango(k, 1, [&](size_t desde, size_t hasta) {
+            for (size_t f = desde; f < hasta; ++f) {
+                // fragmentoLocal da acceso mutable, así que el estado de orden puede estar desactualizado
+                Vector<tipodato> &datos = fragmentos_[f]->datos;
+                datos.revisarOrden();
+                if (!datos.estaOrdenado()) {
+                    datos.ordenar();
+                }
+            }
+        });
+
+        using Cabeza = std::pair<tipodato *, size_t>;   // Elemento actual y fragmento de origen
+        auto mayor = [](const Cabeza &a, const Cabeza &b) { return *b.first < *a.first; };
+        std::priority_queue<Cabeza, std::vector<Cabeza>, decltype(mayor)> cabezas(mayor);
+        Vector<tipodato *> finales;
+        finales.reservar(k);
+        size_t total = 0;
+        for (size_t f = 0; f < k; ++f) {
+            Vector<tipodato> &datos = fragmentos_[f]->datos;
+            total += datos.obtenerTamano();
+            finales.agregarFinal(datos.data() + datos.obtenerTamano());
+            if (!datos.vacio()) {
+                cabezas.emplace(datos.data(), f);
+            }
+        }
+
+        Vector<tipodato> resultado;
+        resultado.reservar(total);
+        while (!cabezas.empty()) {
+            auto [actual, f] = cabezas.top();
+            cabezas.pop();
+            resultado.agregarFinal(std::move(*actual));
+            if (++actual != finales[f]) {
+                cabezas.emplace(actual, f);
+            }
+        }
+
+        for (auto &fragmento : fragmentos_) {
+            fragmento->datos.vaciar();
+        }
+        return resultado;
+    }
+
+    /**
+    * @brief Vacía todos los fragmentos conservando su memoria.
+    */
+    void vaciar() {
+        std::lock_guard<std::mutex> lk(mFragmentos_);
+        for (auto &fragmento : fragmentos_) {
+            fragmento->datos.vaciar();
+        }
+    }
+
+    /**
+    * @brief Aplica `funcion(Vector<tipodato>&)` a cada fragmento, en orden de creación.
+    */
+    template<typename Funcion>
+    void paraCadaFragmento(Funcion &&funcion) {
+        std::lock_guard<std::mutex> lk(mFragmentos_);
+        for (auto &fragmento : fragmentos_) {
+            funcion(fragmento->datos);
+        }
+    }
+
+    /** @name Métodos compatibles con std::vector
+    *Métodos alternativos con nombres en inglés para facilitar la interoperabilidad.
+    */
+    ///@{
+
+    Vector<tipodato> &local_shard() {
+        return fragmentoLocal();
+    }
+    void push_back(const tipodato &value) {
+        agregarFinal(value);
+    }
+    void push_back(tipodato &&value) {
+        agregarFinal(std::move(value));
+    }
+    [[nodiscard]] size_t size() {
+        return obtenerTamano();
+    }
+    [[nodiscard]] bool empty() {
+        return vacio();
+    }
+    [[nodiscard]] size_t shard_count() {
+        return cantidadFragmentos();
+    }
+    /**
+    * @brief Moves every shard into one Vector allocated once, copying in parallel when possible.
+    */
+    Vector<tipodato> merge() {
+        return unir();
+    }
+    /**
+    * @brief K-way merges the (sorted) shards into one sorted Vector.
+    */
+    Vector<tipodato> merge_sorted() {
+        return unirOrdenado();
+    }
+    void clear() {
+        vaciar();
+    }
+    template<typename Function>
+    void for_each_shard(Function &&function) {
+        paraCadaFragmento(std::forward<Function>(function));
+    }
+
+    ///@}
+
+private:
+    /**
+    * @brief Busca o crea el fragmento del hilo actual.
+    */
+    Fragmento *registrarHilo() {
+        std::lock_guard<std::mutex> lk(mFragmentos_);
+        Fragmento *&fragmento = porHilo_[std::this_thread::get_id()];
+        if (!fragmento) {
+            fragmentos_.agregarFinal(std::make_unique<Fragmento>());
+            fragmento = fragmentos_.atras().get();
+        }
+        return fragmento;
+    }
+};
+
+#endif //SHARDEDVECTOR_H
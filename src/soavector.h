@@ -0,0 +1,322 @@
+/**
+ * @file soavector.h
+ * @brief Contenedor estructura-de-arreglos (SoA) con un buffer contiguo por campo
+ *
+ * SoAVector<Ts...> guarda cada campo de un registro en su propio Vector. Todas las columnas
+ * comparten tamaño y capacidad y crecen a la vez, de modo que recorrer un campo solo toca
+ * los bytes de ese campo. Los elementos se leen y escriben a traves de referencias proxy
+ * (std::tuple de referencias), y cada columna se expone como std::span para kernels SIMD.
+ *
+ * @include span
+ * @include tuple
+ * @include cppvector.h
+ *
+ * @author Marian
+ * @date May 31st, 2025
+ *
+ **/
+
+#ifndef SOAVECTOR_H
+#define SOAVECTOR_H
+
+#include <span>
+#include <tuple>
+#include "cppvector.h"
+
+/**
+* @struct SoAVector
+* @brief Vector de registros guardado por columnas (struct of arrays).
+*
+* @tparam Ts Tipos de los campos del registro, en orden.
+*/
+template<typename... Ts>
+struct SoAVector {
+    static_assert(sizeof...(Ts) > 0, "SoAVector necesita al menos un campo");
+
+    static constexpr size_t campos = sizeof...(Ts);
+
+    template<size_t I>
+    using campo_type = std::tuple_element_t<I, std::tuple<Ts...>>;
+
+    using value_type = std::tuple<Ts...>;
+    using reference = std::tuple<Ts&...>;
+    using const_reference = std::tuple<const Ts&...>;
+
+private:
+    std::tuple<Vector<Ts>...> columnas_;    /// < Un Vector por campo, todos del mismo tamaño
+
+public:
+    SoAVector() = default;
+
+    /**
+     * @brief Constructor para la initializer list de registros
+     * @param lista
+     */
+    SoAVector(std::initializer_list<value_type> lista) {
+        reservar(lista.size());
+        for (const value_type &registro : lista) {
+            std::apply([this](const Ts&... valores) { emplace_back(valores...); }, registro);
+        }
+    }
+
+    //
+    //  INICIO SECCION ITERADORES
+    //
+
+    /**
+     * @struct IteradorZip
+     * @brief Iterador de acceso aleatorio que recorre todas las columnas a la vez.
+     *
+     * Al desreferenciarlo devuelve una referencia proxy (std::tuple de referencias) al
+     * registro actual, lo que permite `auto [a, b] = *it;` y asignar campos en sitio.
+     */
+    template<bool Constante>
+    struct IteradorZip {
+        using contenedor = std::conditional_t<Constante, const SoAVector, SoAVector>;
+
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = std::tuple<Ts...>;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::conditional_t<Constante, std::tuple<const Ts&...>, std::tuple<Ts&...>>;
+
+        contenedor *vec;    /// < Contenedor recorrido
+        size_t indice;      /// < Registro actual
+
+        constexpr IteradorZip() noexcept : vec(nullptr), indice(0) {}
+        constexpr IteradorZip(contenedor *v, size_t i) noexcept : vec(v), indice(i) {}
+
+        reference operator*() const { return (*vec)[indice]; }
+        reference operator[](std::ptrdiff_t n) const { return (*vec)[indice + n]; }
+
+        constexpr IteradorZip &operator++() noexcept { ++indice; return *this; }
+        constexpr IteradorZip operator++(int) noexcept { IteradorZip aux = *this; ++indice; return aux; }
+        constexpr IteradorZip &operator--() noexcept { --indice; return *this; }
+        constexpr IteradorZip operator--(int) noexcept { IteradorZip aux = *this; --indice; return aux; }
+
+        constexpr IteradorZip &operator+=(std::ptrdiff_t n) noexcept { indice += n; return *this; }
+        constexpr IteradorZip &operator-=(std::ptrdiff_t n) noexcept { indice -= n; return *this; }
+        constexpr IteradorZip operator+(std::ptrdiff_t n) const noexcept { return IteradorZip(vec, indice + n); }
+        constexpr IteradorZip operator-(std::ptrdiff_t n) const noexcept { return IteradorZip(vec, indice - n); }
+        constexpr difference_type operator-(const IteradorZip &o) const noexcept {
+            return static_cast<difference_type>(indice) - static_cast<difference_type>(o.indice);
+        }
+
+        constexpr bool operator==(const IteradorZip &o) const noexcept { return indice == o.indice; }
+        constexpr bool operator!=(const IteradorZip &o) const noexcept { return indice != o.indice; }
+        constexpr bool operator<(const IteradorZip &o) const noexcept { return indice < o.indice; }
+        constexpr bool operator>(const IteradorZip &o) const noexcept { return indice > o.indice; }
+        constexpr bool operator<=(const IteradorZip &o) const noexcept { return indice <= o.indice; }
+        constexpr bool operator>=(const IteradorZip &o) const noexcept { return indice >= o.indice; }
+    };
+
+    using Iterator = IteradorZip<false>;
+    using ConstIterator = IteradorZip<true>;
+
+    Iterator begin() noexcept { return Iterator(this, 0); }
+    Iterator end() noexcept { return Iterator(this, obtenerTamano()); }
+    ConstIterator begin() const noexcept { return ConstIterator(this, 0); }
+    ConstIterator end() const noexcept { return ConstIterator(this, obtenerTamano()); }
+    ConstIterator cbegin() const noexcept { return begin(); }
+    ConstIterator cend() const noexcept { return end(); }
+
+    //
+    //  FIN DE LA SECCION DE ITERADORES
+    //
+
+    /**
+     * @brief Accede a un registro por índice (no verificado).
+     * @param indice Índice del registro.
+     * @return Referencia proxy con una referencia por campo.
+     */
+    reference operator[](size_t indice) {
+        return std::apply([indice](Vector<Ts>&... columnas) { return reference(columnas[indice]...); }, columnas_);
+    }
+
+    const_reference operator[](size_t indice) const {
+        return std::apply([indice](const Vector<Ts>&... columnas) { return const_reference(columnas[indice]...); }, columnas_);
+    }
+
+    /**
+     * @brief Accede a un registro verificando el índice.
+     * @throws std::out_of_range si el índice es inválido.
+     */
+    reference en(size_t indice) {
+        if (indice >= obtenerTamano()) throw std::out_of_range("Indice fuera de rango");
+        return (*this)[indice];
+    }
+
+    const_reference en(size_t indice) const {
+        if (indice >= obtenerTamano()) throw std::out_of_range("Indice fuera de rango");
+        return (*this)[indice];
+    }
+
+    /**
+     * @brief Accede al campo I del registro `indice` (no verificado).
+     */
+    template<size_t I>
+    campo_type<I> &campo(size_t indice) {
+        return std::get<I>(columnas_)[indice];
+    }
+
+    template<size_t I>
+    const campo_type<I> &campo(size_t indice) const {
+        return std::get<I>(columnas_)[indice];
+    }
+
+    /**
+     * @brief Columna I como span contiguo, apto para kernels SIMD.
+     */
+    template<size_t I>
+    std::span<campo_type<I>> columna() noexcept {
+        auto &col = std::get<I>(columnas_);
+        return std::span<campo_type<I>>(col.data(), col.obtenerTamano());
+    }
+
+    template<size_t I>
+    std::span<const campo_type<I>> columna() const noexcept {
+        const auto &col = std::get<I>(columnas_);
+        return std::span<const campo_type<I>>(col.data(), col.obtenerTamano());
+    }
+
+    /**
+     * @brief Columna I como VectorView (conserva el estado de orden de la columna).
+     */
+    template<size_t I>
+    VectorView<campo_type<I>> vistaColumna() const noexcept {
+        return std::get<I>(columnas_).vista();
+    }
+
+    [[nodiscard]] size_t obtenerTamano() const noexcept {
+        return std::get<0>(columnas_).obtenerTamano();
+    }
+
+    [[nodiscard]] size_t obtenerCapacidad() const noexcept {
+        return std::get<0>(columnas_).obtenerCapacidad();
+    }
+
+    [[nodiscard]] bool vacio() const noexcept {
+        return obtenerTamano() == 0;
+    }
+
+    /**
+     * @brief Reserva la misma capacidad en todas las columnas.
+     * @param nuevaCapacidad Capacidad mínima deseada.
+     */
+    void reservar(size_t nuevaCapacidad) {
+        std::apply([nuevaCapacidad](Vector<Ts>&... columnas) { (columnas.reservar(nuevaCapacidad), ...); }, columnas_);
+    }
+
+    /**
+     * @brief Construye un registro al final, un argumento por campo.
+     *
+     * Todas las columnas crecen en el mismo paso. Si la construccion de un campo lanza una
+     * excepcion, se deshacen los campos ya agregados.
+     */
+    template<typename... Us> requires (sizeof...(Us) == sizeof...(Ts))
+    void emplace_back(Us&&... valores) {
+        if (obtenerTamano() == obtenerCapacidad()) {
+            reservar(obtenerCapacidad() == 0 ? 1 : obtenerCapacidad() * 2);
+        }
+        agregarEn(std::index_sequence_for<Ts...>{}, std::forward<Us>(valores)...);
+    }
+
+    /**
+     * @brief Agrega un registro al final.
+     * @param valores Un valor por campo.
+     */
+    void agregarFinal(const Ts&... valores) {
+        emplace_back(valores...);
+    }
+
+    /**
+     * @brief Elimina el último registro.
+     * @throws std::out_of_range si el contenedor está vacío.
+     */
+    void eliminarFinal() {
+        if (vacio()) throw std::out_of_range("No hay elementos en el vector");
+        std::apply([](Vector<Ts>&... columnas) { (columnas.eliminarFinal(), ...); }, columnas_);
+    }
+
+    /**
+     * @brief Vacía todas las columnas sin liberar memoria.
+     */
+    void vaciar() {
+        std::apply([](Vector<Ts>&... columnas) { (columnas.vaciar(), ...); }, columnas_);
+    }
+
+    /**
+     * @brief Ordena los registros por el campo I, permutando todas las columnas.
+     *
+     * Ordena una permutacion de índices comparando solo la columna I y luego aplica
+     * esa permutacion a cada columna moviendo sus elementos una vez.
+     */
+    template<size_t I>
+    void ordenar() {
+        const auto &clave = std::get<I>(columnas_);
+        const size_t n = obtenerTamano();
+        Vector<size_t> permutacion;
+        permutacion.reservar(n);
+        for (size_t i = 0; i < n; ++i) {
+            permutacion.push_back(i);
+        }
+        std::sort(permutacion.begin(), permutacion.end(),
+                  [&clave](size_t a, size_t b) { return clave[a] < clave[b]; });
+
+        std::apply([&permutacion](Vector<Ts>&... columnas) { (permutar(columnas, permutacion), ...); }, columnas_);
+    }
+
+    /** @name Métodos en inglés
+    *Métodos alternativos con nombres en inglés.
+    */
+    ///@{
+    reference at(size_t index) { return en(index); }
+    const_reference at(size_t index) const { return en(index); }
+    template<size_t I> campo_type<I> &field(size_t index) { return campo<I>(index); }
+    template<size_t I> const campo_type<I> &field(size_t index) const { return campo<I>(index); }
+    template<size_t I> std::span<campo_type<I>> column() noexcept { return columna<I>(); }
+    template<size_t I> std::span<const campo_type<I>> column() const noexcept { return columna<I>(); }
+    template<size_t I> VectorView<campo_type<I>> column_view() const noexcept { return vistaColumna<I>(); }
+    [[nodiscard]] size_t size() const noexcept { return obtenerTamano(); }
+    [[nodiscard]] size_t capacity() const noexcept { return obtenerCapacidad(); }
+    [[nodiscard]] bool empty() const noexcept { return vacio(); }
+    void reserve(size_t newCapacity) { reservar(newCapacity); }
+    void push_back(const Ts&... values) { agregarFinal(values...); }
+    void pop_back() { eliminarFinal(); }
+    void clear() { vaciar(); }
+    template<size_t I> void sort() { ordenar<I>(); }
+    ///@}
+
+private:
+    template<size_t... I, typename... Us>
+    void agregarEn(std::index_sequence<I...>, Us&&... valores) {
+        size_t agregadas = 0;
+        try {
+            ((agregarColumna(std::get<I>(columnas_), std::forward<Us>(valores)), ++agregadas), ...);
+        } catch (...) {
+            ((I < agregadas ? std::get<I>(columnas_).eliminarFinal() : void()), ...);
+            throw;
+        }
+    }
+
+    /// Usa agregarFinal (y no emplace_back) para que cada columna conserve su estado de orden.
+    template<typename T, typename U>
+    static void agregarColumna(Vector<T> &columna, U &&valor) {
+        if constexpr (std::is_same_v<std::remove_cvref_t<U>, T>) {
+            columna.agregarFinal(std::forward<U>(valor));
+        } else {
+            columna.agregarFinal(T(std::forward<U>(valor)));
+        }
+    }
+
+    template<typename T>
+    static void permutar(Vector<T> &columna, const Vector<size_t> &permutacion) {
+        Vector<T> ordenada;
+        ordenada.reservar(columna.obtenerCapacidad());
+        for (size_t i = 0; i < permutacion.obtenerTamano(); ++i) {
+            ordenada.agregarFinal(std::move(columna[permutacion[i]]));
+        }
+        columna.intercambiar(ordenada);
+    }
+};
+
+#endif //SOAVECTOR_H
@@ -0,0 +1,574 @@
+/**
+ * @file stringvector.h
+ * @brief Vector de cadenas con todos los caracteres en un unico bloque contiguo
+ *
+ * StringVector guarda los caracteres de todas las cadenas, uno detras de otro, en una sola
+ * arena de bytes, y un Vector de desplazamientos donde empieza cada una. Agregar una cadena
+ * no reserva memoria propia, copiar el vector son dos copias de bloque, y recorrerlo o
+ * compararlo no salta entre punteros dispersos por el heap.
+ *
+ * Los elementos se devuelven como std::string_view. `ordenar` compara primero un prefijo de
+ * 8 bytes precalculado como entero y solo recurre a la comparacion completa en los empates;
+ * al terminar reescribe la arena en el nuevo orden.
+ *
+ * @include functional
+ * @include string_view
+ * @include string
+ * @include cppvector.h
+ *
+ * @author Marian
+ * @date May 31st, 2025
+ *
+ **/
+
+#ifndef STRINGVECTOR_H
+#define STRINGVECTOR_H
+
+#include <functional>
+#include <string>
+#include <string_view>
+#include "cppvector.h"
+
+/**
+* @struct BasicStringVector
+* @brief Vector de cadenas respaldado por una arena de bytes y una tabla de desplazamientos.
+*
+* @warning Las string_view devueltas apuntan a la arena: dejan de ser válidas cuando se agrega
+*          una cadena que obliga a realocarla, o tras `ordenar`/`eliminarDuplicados`.
+*
+* @tparam tipodesplazamiento Entero sin signo de los desplazamientos; limita el total de bytes
+*/
+template<typename tipodesplazamiento = uint64_t>
+struct BasicStringVector {
+    static_assert(std::is_unsigned_v<tipodesplazamiento> && !std::is_same_v<tipodesplazamiento, bool>,
+                  "tipodesplazamiento debe ser un entero sin signo");
+
+private:
+    Vector<char> arena_;                            /// < Caracteres de todas las cadenas, sin separadores
+    Vector<tipodesplazamiento> desplazamientos_;    /// < Inicio de cada cadena, mas el final de la ultima
+    bool ordenado_;                                 /// < true si las cadenas estan en orden ascendente
+
+public:
+    BasicStringVector() : ordenado_(true) {
+        desplazamientos_.agregarFinal(0);
+    }
+
+    /**
+     * @brief Constructor para la initializer list
+     * @param lista
+     */
+    BasicStringVector(std::initializer_list<std::string_view> lista) : BasicStringVector() {
+        size_t bytes = 0;
+        for (std::string_view cadena : lista) {
+            bytes += cadena.size();
+        }
+        reservar(lista.size(), bytes);
+        for (std::string_view cadena : lista) {
+            agregarFinal(cadena);
+        }
+    }
+
+    /**
+     * @brief Copia las cadenas de un Vector<std::string> a la arena.
+     * @param v
+     */
+    explicit BasicStringVector(const Vector<std::string> &v) : BasicStringVector() {
+        size_t bytes = 0;
+        for (const std::string &cadena : v) {
+            bytes += cadena.size();
+        }
+        reservar(v.obtenerTamano(), bytes);
+        for (const std::string &cadena : v) {
+            agregarFinal(cadena);
+        }
+    }
+
+    //
+    //  LECTURA
+    //
+
+    /**
+    * @brief Accede a una cadena por índice (no verificado).
+    * @param indice Índice de la cadena.
+    * @return Vista de la cadena dentro de la arena.
+    */
+    std::string_view operator[](size_t indice) const noexcept {
+        const tipodesplazamiento desde = desplazamientos_[indice];
+        return std::string_view(arena_.data() + desde, desplazamientos_[indice + 1] - desde);
+    }
+
+    /**
+     * @brief Devuelve la cadena ubicada en un índice específico.
+     * @param indice Índice de la cadena.
+     * @return Vista de la cadena dentro de la arena.
+     * @throws std::out_of_range si el índice es inválido.
+     */
+    std::string_view en(size_t indice) const {
+        if (indice >= obtenerTamano()) {
+            throw std::out_of_range("Indice fuera de rango");
+        }
+        return (*this)[indice];
+    }
+
+    /**
+    * @brief Devuelve la primera cadena.
+    * @throws std::out_of_range Si el vector está vacío.
+    */
+    std::string_view frente() const {
+        if (vacio()) throw std::out_of_range("No hay elementos en el vector");
+        return (*this)[0];
+    }
+
+    /**
+    * @brief Devuelve la última cadena.
+    * @throws std::out_of_range Si el vector está vacío.
+    */
+    std::string_view atras() const {
+        if (vacio()) throw std::out_of_range("No hay elementos en el vector");
+        return (*this)[obtenerTamano() - 1];
+    }
+
+    [[nodiscard]] size_t obtenerTamano() const noexcept {
+        return desplazamientos_.obtenerTamano() - 1;
+    }
+
+    [[nodiscard]] bool vacio() const noexcept {
+        return obtenerTamano() == 0;
+    }
+
+    [[nodiscard]] bool estaOrdenado() const noexcept {
+        return ordenado_;
+    }
+
+    /**
+     * @brief Total de caracteres guardados en la arena.
+     */
+    [[nodiscard]] size_t bytes() const noexcept {
+        return arena_.obtenerTamano();
+    }
+
+    /**
+     * @brief Arena contigua con los caracteres de todas las cadenas.
+     */
+    const char *data() const noexcept {
+        return arena_.data();
+    }
+
+    //
+    //  MODIFICADORES
+    //
+
+    /**
+     * @brief Reserva espacio para `cadenas` cadenas y `bytes` caracteres en total.
+     */
+    void reservar(size_t cadenas, size_t bytes) {
+        desplazamientos_.reservar(cadenas + 1);
+        arena_.reservar(bytes);
+    }
+
+    /**
+     * @brief Agrega una cadena al final copiando sus caracteres a la arena.
+     * @param cadena Cadena a agregar.
+     * @throws std::length_error si la arena supera el rango de tipodesplazamiento.
+     */
+    void agregarFinal(std::string_view cadena) {
+        if (ordenado_ && !vacio() && cadena < atras()) {
+            ordenado_ = false;
+        }
+        copiarEnArena(cadena.data(), cadena.size());
+        desplazamientos_.agregarFinal(static_cast<tipodesplazamiento>(arena_.obtenerTamano()));
+    }
+
+    /**
+     * @brief Agrega todas las cadenas de un texto separado por `delimitador`.
+     *
+     * Copia los caracteres de cada fragmento a la arena y registra su desplazamiento, sin
+     * crear ningún std::string. Un delimitador al final del texto no genera una cadena vacía
+     * extra ("a\nb\n" agrega "a" y "b"); los fragmentos vacíos intermedios sí se conservan.
+     *
+     * @param texto Texto a separar.
+     * @param delimitador Caracter separador (por defecto, salto de línea).
+     * @return Cantidad de cadenas agregadas.
+     */
+    size_t agregarDelimitado(std::string_view texto, char delimitador = '\n') {
+        if (texto.empty()) return 0;
+        texto = std::string_view(reservarArena(texto.data(), texto.size()), texto.size());
+        size_t agregadas = 0;
+        size_t inicio = 0;
+        while (inicio < texto.size()) {
+            const void *encontrado = std::memchr(texto.data() + inicio, delimitador, texto.size() - inicio);
+            const size_t fin = encontrado ? static_cast<size_t>(static_cast<const char *>(encontrado) - texto.data())
+                                          : texto.size();
+            agregarFinal(texto.substr(inicio, fin - inicio));
+            ++agregadas;
+            inicio = fin + 1;
+        }
+        return agregadas;
+    }
+
+    /**
+     * @brief Elimina la última cadena.
+     * @throws std::out_of_range si el vector está vacío.
+     */
+    void eliminarFinal() {
+        if (vacio()) throw std::out_of_range("No hay elementos en el vector");
+        desplazamientos_.eliminarFinal();
+        // erase no reduce la capacidad, así que alternar agregar y eliminar no realoca la arena
+        arena_.erase(arena_.begin() + desplazamientos_.atras(), arena_.end());
+        if (obtenerTamano() <= 1) {
+            ordenado_ = true;
+        }
+    }
+
+    /**
+     * @brief Vacía el vector sin liberar memoria.
+     */
+    void vaciar() {
+        arena_.vaciar();
+        desplazamientos_.vaciar();
+        desplazamientos_.agregarFinal(0);
+        ordenado_ = true;
+    }
+
+    void intercambiar(BasicStringVector &otro) noexcept {
+        arena_.intercambiar(otro.arena_);
+        desplazamientos_.intercambiar(otro.desplazamientos_);
+        std::swap(ordenado_, otro.ordenado_);
+    }
+
+    //
+    //  BUSQUEDA
+    //
+
+    /**
+    * @brief Verifica si el vector contiene una cadena.
+    * @param cadena Cadena a buscar.
+    * @return true si se encuentra la cadena.
+    */
+    bool contiene(std::string_view cadena) const {
+        return buscar(cadena) != -1;
+    }
+
+    /**
+    * @brief Busca la primera aparición de una cadena (búsqueda binaria si está ordenado).
+    * @param cadena Cadena a buscar.
+    * @return Índice de la cadena si se encuentra, -1 en caso contrario.
+    */
+    int buscar(std::string_view cadena) const {
+        if (ordenado_) {
+            const size_t i = limiteInferior(cadena);
+            return i < obtenerTamano() && (*this)[i] == cadena ? static_cast<int>(i) : -1;
+        }
+        for (size_t i = 0; i < obtenerTamano(); ++i) {
+            if ((*this)[i] == cadena) {
+                return static_cast<int>(i);
+            }
+        }
+        return -1;
+    }
+
+    /**
+    * @brief Cuenta cuántas veces aparece una cadena.
+    * @param cadena Cadena a contar.
+    * @return Número de apariciones.
+    */
+    size_t contar(std::string_view cadena) const {
+        size_t contador = 0;
+        size_t i = ordenado_ ? limiteInferior(cadena) : 0;
+        for (; i < obtenerTamano(); ++i) {
+            if ((*this)[i] == cadena) {
+                ++contador;
+            } else if (ordenado_) {
+                break;
+            }
+        }
+        return contador;
+    }
+
+    //
+    //  ORDEN
+    //
+
+    /**
+    * @brief Ordena las cadenas y reescribe la arena en el nuevo orden.
+    *
+    * Cada cadena se representa por sus primeros 8 bytes leídos como entero big-endian, de
+    * modo que la mayoría de las comparaciones son una resta de enteros sin acceder a la
+    * arena; solo los empates de prefijo comparan las cadenas completas.
+    */
+    void ordenar() {
+        if (ordenado_) return;
+        const size_t n = obtenerTamano();
+        Vector<Clave> claves;
+        claves.reservar(n);
+        for (size_t i = 0; i < n; ++i) {
+            claves.agregarFinal(Clave{prefijo((*this)[i]), i});
+        }
+        std::sort(claves.begin(), claves.end(), [this](const Clave &a, const Clave &b) {
+            if (a.prefijo != b.prefijo) return a.prefijo < b.prefijo;
+            return (*this)[a.indice] < (*this)[b.indice];
+        });
+        reconstruir(claves, false);
+        ordenado_ = true;
+    }
+
+    /**
+    * @brief Elimina las cadenas repetidas; el resultado queda ordenado.
+    */
+    void eliminarDuplicados() {
+        ordenar();
+        Vector<Clave> claves;
+        claves.reservar(obtenerTamano());
+        for (size_t i = 0; i < obtenerTamano(); ++i) {
+            claves.agregarFinal(Clave{0, i});
+        }
+        reconstruir(claves, true);
+    }
+
+    /**
+     * @brief Copia las cadenas a un Vector<std::string>.
+     */
+    Vector<std::string> aVector() const {
+        Vector<std::string> resultado;
+        resultado.reservar(obtenerTamano());
+        for (size_t i = 0; i < obtenerTamano(); ++i) {
+            resultado.emplace_back((*this)[i]);
+        }
+        return resultado;
+    }
+
+    bool operator==(const BasicStringVector &otro) const {
+        return desplazamientos_ == otro.desplazamientos_ && arena_ == otro.arena_;
+    }
+
+    bool operator!=(const BasicStringVector &otro) const {
+        return !(*this == otro);
+    }
+
+    /**
+    * @brief Operador de salida.
+    * @param os Flujo de salida.
+    * @param v Vector a imprimir.
+    * @return Referencia al flujo de salida.
+    */
+    friend std::ostream &operator<<(std::ostream &os, const BasicStringVector &v) {
+        os << "[";
+        for (size_t i = 0; i < v.obtenerTamano(); i++) {
+            if (i > 0) os << ", ";
+            os << v[i];
+        }
+        os << "]";
+        return os;
+    }
+
+    //
+    //  ITERADORES
+    //
+
+    /**
+     * @struct ConstIterator
+     * @brief Iterador constante de acceso aleatorio que devuelve string_view por valor.
+     */
+    struct ConstIterator {
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = std::string_view;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::string_view;
+
+        const BasicStringVector *vec = nullptr;     /// < Vector recorrido
+        size_t indice = 0;                          /// < Posicion actual
+
+        ConstIterator() = default;
+        ConstIterator(const BasicStringVector *v, size_t i) : vec(v), indice(i) {}
+
+        std::string_view operator*() const { return (*vec)[indice]; }
+        std::string_view operator[](std::ptrdiff_t n) const { return (*vec)[indice + n]; }
+
+        ConstIterator &operator++() { ++indice; return *this; }
+        ConstIterator operator++(int) { ConstIterator aux = *this; ++indice; return aux; }
+        ConstIterator &operator--() { --indice; return *this; }
+        ConstIterator operator--(int) { ConstIterator aux = *this; --indice; return aux; }
+
+        ConstIterator &operator+=(std::ptrdiff_t n) { indice += n; return *this; }
+        ConstIterator &operator-=(std::ptrdiff_t n) { indice -= n; return *this; }
+        ConstIterator operator+(std::ptrdiff_t n) const { return ConstIterator(vec, indice + n); }
+        ConstIterator operator-(std::ptrdiff_t n) const { return ConstIterator(vec, indice - n); }
+        difference_type operator-(const ConstIterator &o) const {
+            return static_cast<difference_type>(indice) - static_cast<difference_type>(o.indice);
+        }
+        friend ConstIterator operator+(std::ptrdiff_t n, const ConstIterator &it) { return it + n; }
+
+        bool operator==(const ConstIterator &o) const { return indice == o.indice; }
+        bool operator!=(const ConstIterator &o) const { return indice != o.indice; }
+        bool operator<(const ConstIterator &o) const { return indice < o.indice; }
+        bool operator>(const ConstIterator &o) const { return indice > o.indice; }
+        bool operator<=(const ConstIterator &o) const { return indice <= o.indice; }
+        bool operator>=(const ConstIterator &o) const { return indice >= o.indice; }
+    };
+
+    ConstIterator begin() const { return ConstIterator(this, 0); }
+    ConstIterator end() const { return ConstIterator(this, obtenerTamano()); }
+    ConstIterator cbegin() const { return begin(); }
+    ConstIterator cend() const { return end(); }
+
+    static_assert(std::random_access_iterator<ConstIterator>);
+
+    /** @name Métodos compatibles con std::vector
+    *Métodos alternativos con nombres en inglés para facilitar la interoperabilidad.
+    */
+    ///@{
+
+    std::string_view at(size_t index) const {
+        return en(index);
+    }
+    std::string_view front() const {
+        return frente();
+    }
+    std::string_view back() const {
+        return atras();
+    }
+    [[nodiscard]] size_t size() const noexcept {
+        return obtenerTamano();
+    }
+    [[nodiscard]] bool empty() const noexcept {
+        return vacio();
+    }
+    [[nodiscard]] bool isSorted() const noexcept {
+        return estaOrdenado();
+    }
+    void reserve(size_t strings, size_t bytes) {
+        reservar(strings, bytes);
+    }
+    void push_back(std::string_view value) {
+        agregarFinal(value);
+    }
+    void emplace_back(std::string_view value) {
+        agregarFinal(value);
+    }
+    /**
+    * @brief Appends every `delimiter`-separated token of `text`; returns how many were added.
+    */
+    size_t append_delimited(std::string_view text, char delimiter = '\n') {
+        return agregarDelimitado(text, delimiter);
+    }
+    void pop_back() {
+        eliminarFinal();
+    }
+    void clear() {
+        vaciar();
+    }
+    void swap(BasicStringVector &other) noexcept {
+        intercambiar(other);
+    }
+    bool contains(std::string_view value) const {
+        return contiene(value);
+    }
+    int find(std::string_view value) const {
+        return buscar(value);
+    }
+    size_t count(std::string_view value) const {
+        return contar(value);
+    }
+    void sort() {
+        ordenar();
+    }
+    void remove_duplicates() {
+        eliminarDuplicados();
+    }
+    Vector<std::string> to_vector() const {
+        return aVector();
+    }
+
+    ///@}
+
+private:
+    /**
+     * @brief Prefijo de ordenación junto al índice original de la cadena.
+     */
+    struct Clave {
+        uint64_t prefijo;   /// < Primeros 8 bytes en big-endian (relleno con ceros)
+        size_t indice;      /// < Índice de la cadena antes de ordenar
+    };
+
+    /**
+     * @brief Los primeros 8 bytes de la cadena como entero: comparar enteros equivale a
+     *        comparar esos bytes como unsigned char, igual que std::string_view.
+     */
+    static uint64_t prefijo(std::string_view cadena) noexcept {
+        uint64_t clave = 0;
+        const size_t n = std::min<size_t>(cadena.size(), 8);
+        for (size_t i = 0; i < n; ++i) {
+            clave |= uint64_t(static_cast<unsigned char>(cadena[i])) << (8 * (7 - i));
+        }
+        return clave;
+    }
+
+    /**
+     * @brief Primer índice cuya cadena no es menor que `cadena` (requiere ordenado_).
+     */
+    size_t limiteInferior(std::string_view cadena) const {
+        size_t desde = 0, hasta = obtenerTamano();
+        while (desde < hasta) {
+            const size_t medio = desde + (hasta - desde) / 2;
+            if ((*this)[medio] < cadena) {
+                desde = medio + 1;
+            } else {
+                hasta = medio;
+            }
+        }
+        return desde;
+    }
+
+    /**
+     * @brief Asegura lugar para n bytes más en la arena, al menos duplicando la capacidad.
+     *
+     * `datos` puede apuntar a la propia arena (por ejemplo, `agregarFinal(sv[i])`); en ese caso
+     * se devuelve el puntero equivalente dentro de la arena nueva.
+     */
+    const char *reservarArena(const char *datos, size_t n) {
+        const size_t previo = arena_.obtenerTamano();
+        if (previo + n <= arena_.obtenerCapacidad()) return datos;
+        const char *inicio = arena_.data();
+        const bool interno = n > 0 && inicio != nullptr && !std::less<const char *>()(datos, inicio) &&
+                             std::less<const char *>()(datos, inicio + previo);
+        const size_t posicion = interno ? static_cast<size_t>(datos - inicio) : 0;
+        arena_.reservar(std::max(previo + n, arena_.obtenerCapacidad() * 2));
+        return interno ? arena_.data() + posicion : datos;
+    }
+
+    void copiarEnArena(const char *datos, size_t n) {
+        const size_t previo = arena_.obtenerTamano();
+        if (previo + n > std::numeric_limits<tipodesplazamiento>::max()) {
+            throw std::length_error("La arena supera el rango de tipodesplazamiento");
+        }
+        datos = reservarArena(datos, n);
+        char *destino = arena_.agregarSinInicializar(n);
+        if (n > 0) {
+            std::memcpy(destino, datos, n);
+        }
+    }
+
+    /**
+     * @brief Reescribe arena y desplazamientos siguiendo el orden de `claves`.
+     * @param unicas Si es true, omite las cadenas iguales a la anterior.
+     */
+    void reconstruir(const Vector<Clave> &claves, bool unicas) {
+        BasicStringVector nuevo;
+        nuevo.reservar(claves.obtenerTamano(), arena_.obtenerTamano());
+        for (const Clave &clave : claves) {
+            const std::string_view cadena = (*this)[clave.indice];
+            if (unicas && !nuevo.vacio() && nuevo.atras() == cadena) {
+                continue;
+            }
+            nuevo.copiarEnArena(cadena.data(), cadena.size());
+            nuevo.desplazamientos_.agregarFinal(static_cast<tipodesplazamiento>(nuevo.arena_.obtenerTamano()));
+        }
+        nuevo.ordenado_ = ordenado_;
+        intercambiar(nuevo);
+    }
+};
+
+/// Vector de cadenas con desplazamientos de 64 bits.
+using StringVector = BasicStringVector<uint64_t>;
+
+#endif //STRINGVECTOR_H
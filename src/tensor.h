@@ -0,0 +1,492 @@
+/**
+ * @file tensor.h
+ * @brief Arreglos multidimensionales contiguos sobre el almacenamiento de Vector
+ *
+ * Tensor guarda todos sus elementos en un unico Vector (una sola reserva de memoria) y
+ * los direcciona con extensiones y pasos (strides), en orden por filas o por columnas.
+ * Las filas, columnas y sub-bloques se obtienen como vistas sin copiar.
+ *
+ * Si la biblioteca estandar provee std::mdspan (C++23), Tensor y TensorView se pueden
+ * convertir a std::mdspan con layout_stride, y un Tensor se puede construir desde uno.
+ *
+ * @include array
+ * @include mdspan (si esta disponible)
+ * @include cppvector.h
+ *
+ * @author Marian
+ * @date May 31st, 2025
+ *
+ **/
+
+#ifndef TENSOR_H
+#define TENSOR_H
+
+#include <array>
+#include "cppvector.h"
+
+#if __has_include(<mdspan>)
+#include <mdspan>
+#endif
+
+/**
+* @brief Tipos y funciones auxiliares de Tensor.
+*/
+namespace cppvector_tensor {
+
+    /**
+    * @brief Orden de los elementos en memoria.
+    */
+    enum class Layout {
+        RowMajor,       /// < Por filas: el ultimo indice es contiguo (estilo C)
+        ColumnMajor     /// < Por columnas: el primer indice es contiguo (estilo Fortran)
+    };
+
+    /**
+    * @brief Calcula los pasos de un bloque contiguo con las extensiones y el orden dados.
+    */
+    template<size_t Rank>
+    constexpr std::array<size_t, Rank> calcularPasos(const std::array<size_t, Rank> &extensiones, Layout orden) {
+        std::array<size_t, Rank> pasos{};
+        size_t paso = 1;
+        if (orden == Layout::RowMajor) {
+            for (size_t d = Rank; d-- > 0;) {
+                pasos[d] = paso;
+                paso *= extensiones[d];
+            }
+        } else {
+            for (size_t d = 0; d < Rank; ++d) {
+                pasos[d] = paso;
+                paso *= extensiones[d];
+            }
+        }
+        return pasos;
+    }
+}
+
+/**
+* @struct TensorView
+* @brief Vista no propietaria de un arreglo de Rank dimensiones (puntero + extensiones + pasos).
+*
+* Crear una vista, un sub-bloque o un corte es O(1). Con `tipodato` const la vista es de
+* solo lectura.
+*
+* @tparam tipodato Tipo de dato observado (puede ser const)
+* @tparam Rank Cantidad de dimensiones
+*/
+template<typename tipodato, size_t Rank>
+struct TensorView {
+    static_assert(Rank > 0, "TensorView necesita al menos una dimension");
+
+private:
+    tipodato *datos_;                       /// < Primer elemento
+    std::array<size_t, Rank> extensiones_;  /// < Tamaño de cada dimension
+    std::array<size_t, Rank> pasos_;        /// < Distancia en elementos entre indices consecutivos
+
+public:
+    using value_type = std::remove_cv_t<tipodato>;
+    using element_type = tipodato;
+
+    constexpr TensorView() noexcept : datos_(nullptr), extensiones_{}, pasos_{} {}
+
+    constexpr TensorView(tipodato *datos, const std::array<size_t, Rank> &extensiones,
+                         const std::array<size_t, Rank> &pasos) noexcept
+        : datos_(datos), extensiones_(extensiones), pasos_(pasos) {}
+
+    /**
+     * @brief Accede a un elemento por índices (no verificado).
+     */
+    template<typename... Indices> requires (sizeof...(Indices) == Rank)
+    constexpr tipodato &operator()(Indices... indices) const noexcept {
+        const std::array<size_t, Rank> idx{static_cast<size_t>(indices)...};
+        return datos_[desplazamiento(idx)];
+    }
+
+    /**
+     * @brief Accede a un elemento por índices verificando los límites.
+     * @throws std::out_of_range si algún índice es inválido.
+     */
+    template<typename... Indices> requires (sizeof...(Indices) == Rank)
+    tipodato &en(Indices... indices) const {
+        const std::array<size_t, Rank> idx{static_cast<size_t>(indices)...};
+        for (size_t d = 0; d < Rank; ++d) {
+            if (idx[d] >= extensiones_[d]) throw std::out_of_range("Indice fuera de rango");
+        }
+        return datos_[desplazamiento(idx)];
+    }
+
+    [[nodiscard]] constexpr size_t extension(size_t dimension) const noexcept {
+        return extensiones_[dimension];
+    }
+
+    [[nodiscard]] constexpr size_t paso(size_t dimension) const noexcept {
+        return pasos_[dimension];
+    }
+
+    [[nodiscard]] constexpr const std::array<size_t, Rank> &extensiones() const noexcept {
+        return extensiones_;
+    }
+
+    [[nodiscard]] constexpr const std::array<size_t, Rank> &pasos() const noexcept {
+        return pasos_;
+    }
+
+    /**
+     * @brief Cantidad total de elementos visibles.
+     */
+    [[nodiscard]] constexpr size_t obtenerTamano() const noexcept {
+        size_t total = 1;
+        for (size_t e : extensiones_) total *= e;
+        return total;
+    }
+
+    constexpr tipodato *data() const noexcept {
+        return datos_;
+    }
+
+    /**
+     * @brief Sub-bloque que empieza en `inicio` con las extensiones dadas, en O(1).
+     * @throws std::out_of_range si el bloque excede la vista.
+     */
+    TensorView bloque(const std::array<size_t, Rank> &inicio, const std::array<size_t, Rank> &extensiones) const {
+        for (size_t d = 0; d < Rank; ++d) {
+            if (inicio[d] + extensiones[d] > extensiones_[d]) throw std::out_of_range("Bloque fuera de rango");
+        }
+        return TensorView(datos_ + desplazamiento(inicio), extensiones, pasos_);
+    }
+
+    /**
+     * @brief Fija el índice de una dimension y devuelve la vista de Rank - 1 dimensiones, en O(1).
+     * @throws std::out_of_range si la dimension o el índice son inválidos.
+     */
+    TensorView<tipodato, Rank - 1> corte(size_t dimension, size_t indice) const requires (Rank > 1) {
+        if (dimension >= Rank || indice >= extensiones_[dimension]) throw std::out_of_range("Indice fuera de rango");
+        std::array<size_t, Rank - 1> extensiones{}, pasos{};
+        for (size_t d = 0, k = 0; d < Rank; ++d) {
+            if (d == dimension) continue;
+            extensiones[k] = extensiones_[d];
+            pasos[k++] = pasos_[d];
+        }
+        return TensorView<tipodato, Rank - 1>(datos_ + indice * pasos_[dimension], extensiones, pasos);
+    }
+
+    /**
+     * @brief Fila `i` de una vista bidimensional como VectorView de solo lectura.
+     */
+    VectorView<value_type> fila(size_t i) const requires (Rank == 2) {
+        if (i >= extensiones_[0]) throw std::out_of_range("Indice fuera de rango");
+        return VectorView<value_type>(datos_ + i * pasos_[0], extensiones_[1], false, pasos_[1]);
+    }
+
+    /**
+     * @brief Columna `j` de una vista bidimensional como VectorView de solo lectura.
+     */
+    VectorView<value_type> columna(size_t j) const requires (Rank == 2) {
+        if (j >= extensiones_[1]) throw std::out_of_range("Indice fuera de rango");
+        return VectorView<value_type>(datos_ + j * pasos_[1], extensiones_[0], false, pasos_[0]);
+    }
+
+#if defined(__cpp_lib_mdspan)
+    /**
+     * @brief Convierte la vista a std::mdspan con layout_stride.
+     */
+    auto aMdspan() const {
+        using ext_t = std::dextents<size_t, Rank>;
+        const typename std::layout_stride::template mapping<ext_t> mapa(ext_t(extensiones_), pasos_);
+        return std::mdspan<tipodato, ext_t, std::layout_stride>(datos_, mapa);
+    }
+
+    auto to_mdspan() const { return aMdspan(); }
+#endif
+
+    template<typename... Indices> requires (sizeof...(Indices) == Rank)
+    tipodato &at(Indices... indices) const { return en(indices...); }
+    [[nodiscard]] constexpr size_t extent(size_t dimension) const noexcept { return extension(dimension); }
+    [[nodiscard]] constexpr size_t stride(size_t dimension) const noexcept { return paso(dimension); }
+    [[nodiscard]] constexpr size_t size() const noexcept { return obtenerTamano(); }
+    TensorView block(const std::array<size_t, Rank> &start, const std::array<size_t, Rank> &extents) const { return bloque(start, extents); }
+    TensorView<tipodato, Rank - 1> slice(size_t dimension, size_t index) const requires (Rank > 1) { return corte(dimension, index); }
+    VectorView<value_type> row(size_t i) const requires (Rank == 2) { return fila(i); }
+    VectorView<value_type> col(size_t j) const requires (Rank == 2) { return columna(j); }
+
+private:
+    constexpr size_t desplazamiento(const std::array<size_t, Rank> &idx) const noexcept {
+        size_t offset = 0;
+        for (size_t d = 0; d < Rank; ++d) {
+            offset += idx[d] * pasos_[d];
+        }
+        return offset;
+    }
+};
+
+/**
+* @struct Tensor
+* @brief Arreglo de Rank dimensiones guardado de forma contigua en un único Vector.
+*
+* @tparam tipodato Tipo de dato almacenado
+* @tparam Rank Cantidad de dimensiones
+*/
+template<typename tipodato, size_t Rank, typename Allocator = std::allocator<tipodato> >
+struct Tensor {
+    static_assert(Rank > 0, "Tensor necesita al menos una dimension");
+
+    /// Orden en memoria, accesible como `Matrix<double>::Layout::ColumnMajor`.
+    using Layout = cppvector_tensor::Layout;
+
+private:
+    Vector<tipodato, Allocator> datos_;     /// < Elementos, en un único bloque contiguo
+    std::array<size_t, Rank> extensiones_;  /// < Tamaño de cada dimension
+    std::array<size_t, Rank> pasos_;        /// < Pasos derivados de las extensiones y el orden
+    Layout orden_;                          /// < Orden de los elementos en memoria
+
+    static size_t total(const std::array<size_t, Rank> &extensiones) {
+        size_t n = 1;
+        for (size_t e : extensiones) n *= e;
+        return n;
+    }
+
+public:
+    using value_type = tipodato;
+    using view_type = TensorView<tipodato, Rank>;
+    using const_view_type = TensorView<const tipodato, Rank>;
+
+    Tensor() : extensiones_{}, pasos_{}, orden_(Layout::RowMajor) {}
+
+    /**
+     * @brief Crea un tensor con las extensiones dadas, relleno con `valor`.
+     * @param extensiones Tamaño de cada dimension.
+     * @param valor Valor inicial de todos los elementos.
+     * @param orden Orden en memoria (por filas por defecto).
+     */
+    explicit Tensor(const std::array<size_t, Rank> &extensiones, const tipodato &valor = tipodato(),
+                    Layout orden = Layout::RowMajor)
+        : datos_(total(extensiones), valor), extensiones_(extensiones),
+          pasos_(cppvector_tensor::calcularPasos(extensiones, orden)), orden_(orden) {}
+
+    /**
+     * @brief Crea una matriz de `filas` x `columnas`, rellena con `valor`.
+     */
+    Tensor(size_t filas, size_t columnas, const tipodato &valor = tipodato(), Layout orden = Layout::RowMajor)
+        requires (Rank == 2)
+        : Tensor(std::array<size_t, 2>{filas, columnas}, valor, orden) {}
+
+    /**
+     * @brief Toma posesion de un Vector ya relleno, interpretandolo con las extensiones dadas.
+     * @throws std::invalid_argument si el tamaño del Vector no coincide.
+     */
+    Tensor(Vector<tipodato, Allocator> &&datos, const std::array<size_t, Rank> &extensiones,
+           Layout orden = Layout::RowMajor)
+        : datos_(std::move(datos)), extensiones_(extensiones),
+          pasos_(cppvector_tensor::calcularPasos(extensiones, orden)), orden_(orden) {
+        if (datos_.obtenerTamano() != total(extensiones_)) {
+            throw std::invalid_argument("El tamaño del Vector no coincide con las extensiones");
+        }
+    }
+
+#if defined(__cpp_lib_mdspan)
+    /**
+     * @brief Copia el contenido de un std::mdspan de cualquier layout.
+     */
+    template<typename T, typename Extents, typename LayoutPolicy, typename Accessor>
+        requires (Extents::rank() == Rank)
+    explicit Tensor(std::mdspan<T, Extents, LayoutPolicy, Accessor> origen, Layout orden = Layout::RowMajor)
+        : Tensor(extensionesDe(origen.extents()), tipodato(), orden) {
+        std::array<size_t, Rank> idx{};
+        for (size_t n = 0; n < datos_.obtenerTamano(); ++n) {
+            elemento(idx) = origen[idx];
+            avanzar(idx);
+        }
+    }
+#endif
+
+    //
+    //  ACCESO
+    //
+
+    /**
+     * @brief Accede a un elemento por índices (no verificado).
+     */
+    template<typename... Indices> requires (sizeof...(Indices) == Rank)
+    tipodato &operator()(Indices... indices) noexcept {
+        return elemento({static_cast<size_t>(indices)...});
+    }
+
+    template<typename... Indices> requires (sizeof...(Indices) == Rank)
+    const tipodato &operator()(Indices... indices) const noexcept {
+        return datos_[desplazamiento({static_cast<size_t>(indices)...})];
+    }
+
+    /**
+     * @brief Accede a un elemento por índices verificando los límites.
+     * @throws std::out_of_range si algún índice es inválido.
+     */
+    template<typename... Indices> requires (sizeof...(Indices) == Rank)
+    tipodato &en(Indices... indices) {
+        return vista().en(indices...);
+    }
+
+    template<typename... Indices> requires (sizeof...(Indices) == Rank)
+    const tipodato &en(Indices... indices) const {
+        return vista().en(indices...);
+    }
+
+    [[nodiscard]] size_t extension(size_t dimension) const noexcept {
+        return extensiones_[dimension];
+    }
+
+    [[nodiscard]] size_t paso(size_t dimension) const noexcept {
+        return pasos_[dimension];
+    }
+
+    [[nodiscard]] const std::array<size_t, Rank> &extensiones() const noexcept {
+        return extensiones_;
+    }
+
+    [[nodiscard]] Layout disposicion() const noexcept {
+        return orden_;
+    }
+
+    [[nodiscard]] size_t obtenerTamano() const noexcept {
+        return datos_.obtenerTamano();
+    }
+
+    tipodato *data() noexcept {
+        return datos_.data();
+    }
+
+    const tipodato *data() const noexcept {
+        return datos_.data();
+    }
+
+    /**
+     * @brief Vector subyacente (un único bloque contiguo, en el orden de memoria del tensor).
+     */
+    const Vector<tipodato, Allocator> &datos() const noexcept {
+        return datos_;
+    }
+
+    /**
+     * @brief Rellena todos los elementos con `valor`.
+     */
+    void rellenar(const tipodato &valor) {
+        std::fill(datos_.begin(), datos_.end(), valor);
+    }
+
+    //
+    //  VISTAS
+    //
+
+    view_type vista() noexcept {
+        return view_type(datos_.data(), extensiones_, pasos_);
+    }
+
+    const_view_type vista() const noexcept {
+        return const_view_type(datos_.data(), extensiones_, pasos_);
+    }
+
+    /**
+     * @brief Sub-bloque que empieza en `inicio` con las extensiones dadas, sin copiar.
+     * @throws std::out_of_range si el bloque excede el tensor.
+     */
+    view_type bloque(const std::array<size_t, Rank> &inicio, const std::array<size_t, Rank> &extensiones) {
+        return vista().bloque(inicio, extensiones);
+    }
+
+    const_view_type bloque(const std::array<size_t, Rank> &inicio, const std::array<size_t, Rank> &extensiones) const {
+        return vista().bloque(inicio, extensiones);
+    }
+
+    /**
+     * @brief Fija el índice de una dimension y devuelve la vista resultante, sin copiar.
+     */
+    TensorView<tipodato, Rank - 1> corte(size_t dimension, size_t indice) requires (Rank > 1) {
+        return vista().corte(dimension, indice);
+    }
+
+    TensorView<const tipodato, Rank - 1> corte(size_t dimension, size_t indice) const requires (Rank > 1) {
+        return vista().corte(dimension, indice);
+    }
+
+    /**
+     * @brief Fila `i` de una matriz como VectorView (contigua si el orden es por filas).
+     */
+    VectorView<tipodato> fila(size_t i) const requires (Rank == 2) {
+        return vista().fila(i);
+    }
+
+    /**
+     * @brief Columna `j` de una matriz como VectorView (contigua si el orden es por columnas).
+     */
+    VectorView<tipodato> columna(size_t j) const requires (Rank == 2) {
+        return vista().columna(j);
+    }
+
+#if defined(__cpp_lib_mdspan)
+    auto aMdspan() { return vista().aMdspan(); }
+    auto aMdspan() const { return vista().aMdspan(); }
+    auto to_mdspan() { return aMdspan(); }
+    auto to_mdspan() const { return aMdspan(); }
+#endif
+
+    /** @name Métodos en inglés
+    *Métodos alternativos con nombres en inglés.
+    */
+    ///@{
+    template<typename... Indices> requires (sizeof...(Indices) == Rank)
+    tipodato &at(Indices... indices) { return en(indices...); }
+    template<typename... Indices> requires (sizeof...(Indices) == Rank)
+    const tipodato &at(Indices... indices) const { return en(indices...); }
+    [[nodiscard]] size_t extent(size_t dimension) const noexcept { return extension(dimension); }
+    [[nodiscard]] size_t stride(size_t dimension) const noexcept { return paso(dimension); }
+    [[nodiscard]] Layout layout() const noexcept { return disposicion(); }
+    [[nodiscard]] size_t size() const noexcept { return obtenerTamano(); }
+    void fill(const tipodato &value) { rellenar(value); }
+    view_type view() noexcept { return vista(); }
+    const_view_type view() const noexcept { return vista(); }
+    view_type block(const std::array<size_t, Rank> &start, const std::array<size_t, Rank> &extents) { return bloque(start, extents); }
+    const_view_type block(const std::array<size_t, Rank> &start, const std::array<size_t, Rank> &extents) const { return bloque(start, extents); }
+    TensorView<tipodato, Rank - 1> slice(size_t dimension, size_t index) requires (Rank > 1) { return corte(dimension, index); }
+    TensorView<const tipodato, Rank - 1> slice(size_t dimension, size_t index) const requires (Rank > 1) { return corte(dimension, index); }
+    VectorView<tipodato> row(size_t i) const requires (Rank == 2) { return fila(i); }
+    VectorView<tipodato> col(size_t j) const requires (Rank == 2) { return columna(j); }
+    ///@}
+
+private:
+    size_t desplazamiento(const std::array<size_t, Rank> &idx) const noexcept {
+        size_t offset = 0;
+        for (size_t d = 0; d < Rank; ++d) {
+            offset += idx[d] * pasos_[d];
+        }
+        return offset;
+    }
+
+    tipodato &elemento(const std::array<size_t, Rank> &idx) noexcept {
+        return datos_[desplazamiento(idx)];
+    }
+
+#if defined(__cpp_lib_mdspan)
+    template<typename Extents>
+    static std::array<size_t, Rank> extensionesDe(const Extents &ext) {
+        std::array<size_t, Rank> extensiones{};
+        for (size_t d = 0; d < Rank; ++d) {
+            extensiones[d] = static_cast<size_t>(ext.extent(d));
+        }
+        return extensiones;
+    }
+
+    /// Avanza un índice multidimensional en orden por filas.
+    void avanzar(std::array<size_t, Rank> &idx) const noexcept {
+        for (size_t d = Rank; d-- > 0;) {
+            if (++idx[d] < extensiones_[d]) return;
+            idx[d] = 0;
+        }
+    }
+#endif
+};
+
+/**
+* @brief Matriz contigua de dos dimensiones.
+*/
+template<typename tipodato, typename Allocator = std::allocator<tipodato> >
+using Matrix = Tensor<tipodato, 2, Allocator>;
+
+#endif //TENSOR_H
@@ -0,0 +1,386 @@
+/**
+ * @file threadpool.h
+ * @brief Planificador con robo de trabajo y algoritmos paralelos sobre contenedores contiguos
+ *
+ * PoolHilos mantiene una cola de tareas por hilo: cada hilo toma trabajo del final de su
+ * propia cola y, cuando se queda sin trabajo, roba del inicio de la cola de otro. Los bucles
+ * paralelos dividen el rango por mitades y encolan una mitad, de modo que los hilos ociosos
+ * roban siempre los bloques mas grandes pendientes.
+ *
+ * Las politicas `seq`, `par` y `par_unseq` seleccionan las sobrecargas paralelas de Vector
+ * sin depender del soporte de std::execution de cada compilador. El hilo que llama tambien
+ * ejecuta tareas mientras espera, por lo que los bucles paralelos pueden anidarse.
+ *
+ * @include atomic
+ * @include condition_variable
+ * @include deque
+ * @include functional
+ * @include mutex
+ * @include optional
+ * @include thread
+ * @include vector
+ *
+ * @author Marian
+ * @date May 31st, 2025
+ *
+ **/
+
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/**
+* @brief Politicas de ejecucion y planificador usados por los algoritmos paralelos.
+*/
+namespace cppvector_paralelo {
+
+    /// Ejecucion en el hilo que llama.
+    struct PoliticaSecuencial {};
+    /// Ejecucion repartida entre los hilos del pool global.
+    struct PoliticaParalela {};
+    /// Igual que PoliticaParalela; cada bloque ya usa los kernels SIMD cuando el tipo lo permite.
+    struct PoliticaParalelaVectorizada {};
+
+    inline constexpr PoliticaSecuencial seq{};
+    inline constexpr PoliticaParalela par{};
+    inline constexpr PoliticaParalelaVectorizada par_unseq{};
+
+    template<typename T>
+    concept PoliticaEjecucion = std::is_same_v<std::remove_cvref_t<T>, PoliticaSecuencial> ||
+                                std::is_same_v<std::remove_cvref_t<T>, PoliticaParalela> ||
+                                std::is_same_v<std::remove_cvref_t<T>, PoliticaParalelaVectorizada>;
+
+    template<typename T>
+    inline constexpr bool es_secuencial_v = std::is_same_v<std::remove_cvref_t<T>, PoliticaSecuencial>;
+
+    /**
+    * @class PoolHilos
+    * @brief Pool de hilos con una cola por hilo y robo de trabajo.
+    */
+    class PoolHilos {
+    public:
+        /**
+        * @param hilos Hilos trabajadores; el hilo que espera un bucle paralelo trabaja además de ellos.
+        */
+        explicit PoolHilos(size_t hilos = std::max<size_t>(std::thread::hardware_concurrency(), 1) - 1) {
+            // Una cola por trabajador y una ultima para las tareas enviadas desde fuera del pool
+            for (size_t i = 0; i <= hilos; ++i) {
+                colas_.push_back(std::make_unique<Cola>());
+            }
+            hilos_.reserve(hilos);
+            for (size_t i = 0; i < hilos; ++i) {
+                hilos_.emplace_back([this, i] { trabajar(i); });
+            }
+        }
+
+        PoolHilos(const PoolHilos &) = delete;
+        PoolHilos &operator=(const PoolHilos &) = delete;
+
+        /**
+        * @brief Termina las tareas pendientes y espera a los trabajadores.
+        */
+        ~PoolHilos() {
+            {
+                std::lock_guard<std::mutex> lk(mEspera_);
+                detener_ = true;
+            }
+            cvEspera_.notify_all();
+            for (std::thread &hilo : hilos_) {
+                hilo.join();
+            }
+        }
+
+        /**
+        * @brief Encola una tarea: en la cola propia si la envía un trabajador, si no en la compartida.
+        */
+        void enviar(std::function<void()> tarea) {
+            Cola &cola = *colas_[poolActual_ == this ? indiceActual_ : hilos_.size()];
+            {
+                std::lock_guard<std::mutex> lk(cola.m);
+                cola.tareas.push_back(std::move(tarea));
+                pendientes_.fetch_add(1, std::memory_order_release);
+            }
+            {
+                std::lock_guard<std::mutex> lk(mEspera_);
+            }
+            cvEspera_.notify_one();
+        }
+
+        /**
+        * @brief Ejecuta una tarea pendiente, propia o robada, si hay alguna.
+        * @return true si ejecutó una tarea.
+        */
+        bool ejecutarUna() {
+            const size_t propia = poolActual_ == this ? indiceActual_ : hilos_.size();
+            std::function<void()> tarea;
+            if (!tomar(propia, true, tarea)) {
+                bool robada = false;
+                for (size_t k = 1; k < colas_.size() && !robada; ++k) {
+                    robada = tomar((propia + k) % colas_.size(), false, tarea);
+                }
+                if (!robada) return false;
+            }
+            tarea();
+            return true;
+        }
+
+        /**
+        * @brief Hilos que ejecutan un bucle paralelo: los trabajadores más el que espera.
+        */
+        [[nodiscard]] size_t obtenerHilos() const noexcept {
+            return hilos_.size() + 1;
+        }
+
+    private:
+        struct Cola {
+            std::mutex m;
+            std::deque<std::function<void()>> tareas;
+        };
+
+        std::vector<std::unique_ptr<Cola>> colas_;      /// < Una por trabajador, mas la compartida al final
+        std::vector<std::thread> hilos_;                /// < Trabajadores
+        std::atomic<size_t> pendientes_{0};             /// < Tareas encoladas sin tomar
+        std::mutex mEspera_;                            /// < Protege la espera de los trabajadores ociosos
+        std::condition_variable cvEspera_;
+        bool detener_ = false;                          /// < Protegido por mEspera_
+
+        inline static thread_local PoolHilos *poolActual_ = nullptr;   /// < Pool del trabajador actual
+        inline static thread_local size_t indiceActual_ = 0;           /// < Cola propia del trabajador actual
+
+        /**
+        * @brief Toma una tarea del final (cola propia) o del inicio (robo) de una cola.
+        */
+        bool tomar(size_t indice, bool delFinal, std::function<void()> &tarea) {
+            Cola &cola = *colas_[indice];
+            std::lock_guard<std::mutex> lk(cola.m);
+            if (cola.tareas.empty()) return false;
+            if (delFinal) {
+                tarea = std::move(cola.tareas.back());
+                cola.tareas.pop_back();
+            } else {
+                tarea = std::move(cola.tareas.front());
+                cola.tareas.pop_front();
+            }
+            pendientes_.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        void trabajar(size_t indice) {
+            poolActual_ = this;
+            indiceActual_ = indice;
+            while (true) {
+                if (ejecutarUna()) continue;
+                std::unique_lock<std::mutex> lk(mEspera_);
+                cvEspera_.wait(lk, [this] { return detener_ || pendientes_.load(std::memory_order_acquire) > 0; });
+                if (detener_ && pendientes_.load(std::memory_order_acquire) == 0) return;
+            }
+        }
+    };
+
+    /**
+    * @brief Pool compartido por todos los algoritmos paralelos (se crea en el primer uso).
+    */
+    inline PoolHilos &poolGlobal() {
+        static PoolHilos pool;
+        return pool;
+    }
+
+    /**
+    * @brief Tamaño de bloque por defecto: unos 8 bloques por hilo, nunca menos de `minimo` elementos.
+    */
+    inline size_t granoPorDefecto(size_t n, size_t minimo = 4096) {
+        return std::max(n / (poolGlobal().obtenerHilos() * 8), minimo);
+    }
+
+    /**
+    * @brief Estado compartido de un bucle paralelo: cuenta de tareas vivas y primer error.
+    */
+    template<typename Funcion>
+    struct TrabajoRango {
+        PoolHilos &pool;
+        Funcion &funcion;
+        size_t grano;
+        std::atomic<size_t> restantes{1};
+        std::exception_ptr error;
+        std::mutex mError;
+
+        TrabajoRango(PoolHilos &p, Funcion &f, size_t g) : pool(p), funcion(f), grano(g) {}
+
+        /**
+        * @brief Encola la mitad superior mientras el rango supere el grano y procesa el resto.
+        */
+        void procesar(size_t desde, size_t hasta) {
+            try {
+                while (hasta - desde > grano) {
+                    const size_t medio = desde + (hasta - desde) / 2;
+                    restantes.fetch_add(1, std::memory_order_relaxed);
+                    pool.enviar([this, medio, hasta] { procesar(medio, hasta); });
+                    hasta = medio;
+                }
+                funcion(desde, hasta);
+            } catch (...) {
+                std::lock_guard<std::mutex> lk(mError);
+                if (!error) error = std::current_exception();
+            }
+            restantes.fetch_sub(1, std::memory_order_acq_rel);
+        }
+    };
+
+    /**
+    * @brief Ejecuta `funcion(desde, hasta)` sobre bloques de [0, n) en paralelo.
+    *
+    * El hilo que llama participa y no retorna hasta que terminan todos los bloques. Si algún
+    * bloque lanza una excepción, se relanza la primera al terminar.
+    *
+    * @param n Tamaño del rango.
+    * @param grano Tamaño máximo de bloque (0 = granoPorDefecto).
+    * @param funcion Invocable con (size_t desde, size_t hasta).
+    */
+    template<typename Funcion>
+    void paraRango(size_t n, size_t grano, Funcion &&funcion) {
+        if (n == 0) return;
+        if (grano == 0) grano = granoPorDefecto(n);
+        PoolHilos &pool = poolGlobal();
+        if (n <= grano || pool.obtenerHilos() == 1) {
+            funcion(size_t(0), n);
+            return;
+        }
+        TrabajoRango<std::remove_reference_t<Funcion>> trabajo(pool, funcion, grano);
+        trabajo.procesar(0, n);
+        while (trabajo.restantes.load(std::memory_order_acquire) != 0) {
+            if (!pool.ejecutarUna()) {
+                std::this_thread::yield();
+            }
+        }
+        if (trabajo.error) std::rethrow_exception(trabajo.error);
+    }
+
+    /**
+    * @brief Como paraRango, pero los bloques de [0, n) empiezan en límites de página de `base`.
+    *
+    * Cada página queda entera dentro de un bloque, así que nunca la escriben dos hilos; y al
+    * llenar memoria recién reservada, cada página se toca por primera vez desde el hilo que
+    * la llena (first touch), lo que la ubica en su nodo NUMA.
+    *
+    * @param base Inicio del arreglo de n elementos.
+    * @param funcion Invocable con (size_t desde, size_t hasta), en índices de elemento.
+    */
+    template<typename T, typename Funcion>
+    void paraPaginas(const T *base, size_t n, Funcion &&funcion) {
+        constexpr size_t bytesPagina = 4096;
+        constexpr size_t porPagina = sizeof(T) < bytesPagina ? bytesPagina / sizeof(T) : 1;
+        const size_t desfase = (reinterpret_cast<uintptr_t>(base) % bytesPagina) / sizeof(T);
+        const size_t primero = std::min(n, (porPagina - desfase % porPagina) % porPagina);
+        // La página 0 es el tramo [0, primero) hasta el primer límite; las demás son completas
+        const size_t paginas = 1 + (n - primero + porPagina - 1) / porPagina;
+        auto inicio = [&](size_t p) { return p == 0 ? 0 : std::min(n, primero + (p - 1) * porPagina); };
+        const size_t grano = std::max<size_t>(granoPorDefecto(n) / porPagina, 1);
+        paraRango(paginas, grano, [&](size_t desde, size_t hasta) {
+            funcion(inicio(desde), inicio(hasta));
+        });
+    }
+
+    /**
+    * @brief Aplica `funcion` a cada elemento de un contenedor contiguo en paralelo.
+    * @param grano Elementos por bloque (0 = automático).
+    */
+    template<typename Contenedor, typename Funcion>
+    void paraCada(Contenedor &c, Funcion funcion, size_t grano = 0) {
+        auto *datos = c.data();
+        paraRango(c.size(), grano, [&](size_t desde, size_t hasta) {
+            for (size_t i = desde; i < hasta; ++i) {
+                funcion(datos[i]);
+            }
+        });
+    }
+
+    /**
+    * @brief Escribe `funcion(entrada[i])` en `salida[i]`; redimensiona `salida` al tamaño de `entrada`.
+    * @param grano Elementos por bloque (0 = automático).
+    */
+    template<typename Entrada, typename Salida, typename Funcion>
+    void transformar(const Entrada &entrada, Salida &salida, Funcion funcion, size_t grano = 0) {
+        salida.resize(entrada.size());
+        const auto *origen = entrada.data();
+        auto *destino = salida.data();
+        paraRango(entrada.size(), grano, [&](size_t desde, size_t hasta) {
+            for (size_t i = desde; i < hasta; ++i) {
+                destino[i] = funcion(origen[i]);
+            }
+        });
+    }
+
+    /**
+    * @brief Combina todos los elementos con una operación asociativa, en paralelo.
+    *
+    * Cada bloque se reduce por separado y los resultados parciales se combinan en orden,
+    * así que la operación no necesita ser conmutativa.
+    *
+    * @param inicial Valor con el que se combina el resultado.
+    * @param combinar Operación asociativa; se aplica a (T, elemento) y a (T, T).
+    * @param grano Elementos por bloque (0 = automático).
+    */
+    template<typename Contenedor, typename T, typename Combinar = std::plus<>>
+    T reducir(const Contenedor &c, T inicial, Combinar combinar = {}, size_t grano = 0) {
+        const size_t n = c.size();
+        if (n == 0) return inicial;
+        if (grano == 0) grano = granoPorDefecto(n);
+        const auto *datos = c.data();
+        const size_t bloques = (n + grano - 1) / grano;
+        std::vector<std::optional<T>> parciales(bloques);
+        paraRango(bloques, 1, [&](size_t primero, size_t ultimo) {
+            for (size_t b = primero; b < ultimo; ++b) {
+                const size_t desde = b * grano;
+                const size_t hasta = std::min(n, desde + grano);
+                T acumulado = static_cast<T>(datos[desde]);
+                for (size_t i = desde + 1; i < hasta; ++i) {
+                    acumulado = combinar(std::move(acumulado), datos[i]);
+                }
+                parciales[b].emplace(std::move(acumulado));
+            }
+        });
+        for (std::optional<T> &parcial : parciales) {
+            inicial = combinar(std::move(inicial), std::move(*parcial));
+        }
+        return inicial;
+    }
+}
+
+/**
+* @brief Applies `function` to every element of a contiguous container (e.g. Vector) in parallel.
+*/
+template<typename Container, typename Function>
+void parallel_for_each(Container &c, Function function, size_t grain = 0) {
+    cppvector_paralelo::paraCada(c, std::move(function), grain);
+}
+
+/**
+* @brief Writes `function(input[i])` to `output[i]` in parallel, resizing `output` first.
+*/
+template<typename Input, typename Output, typename Function>
+void parallel_transform(const Input &input, Output &output, Function function, size_t grain = 0) {
+    cppvector_paralelo::transformar(input, output, std::move(function), grain);
+}
+
+/**
+* @brief Folds every element with an associative operation in parallel.
+*/
+template<typename Container, typename T, typename Combine = std::plus<>>
+T parallel_reduce(const Container &c, T init, Combine combine = {}, size_t grain = 0) {
+    return cppvector_paralelo::reducir(c, std::move(init), std::move(combine), grain);
+}
+
+#endif //THREADPOOL_H